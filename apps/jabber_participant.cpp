@@ -112,17 +112,15 @@ int main(int argc, char *argv[])
    AcousticField field = InitializeAcousticField(conf, coords, dim);
    ROOT std::cout << "Done!" << std::endl;
 
-   double time = conf.Comp().t0;
    double dt;
 
-   // Compute acoustic forcing
+   // Compute initial acoustic forcing
+   field.Compute(conf.Comp().t0);
+
    while (participant.isCouplingOngoing())
    {
       dt = participant.getMaxTimeStepSize();
 
-      // Compute acoustic forcing
-      field.Compute(time);
-
       // Send data
       participant.writeData(precice_conf.fluid_mesh_name, "rho",
                              vertex_ids, field.Density());
@@ -135,7 +133,9 @@ int main(int argc, char *argv[])
       participant.writeData(precice_conf.fluid_mesh_name, "rhoE",
                              vertex_ids, field.Energy());       
       participant.advance(dt);
-      time += dt;
+
+      // Compute acoustic forcing at next time
+      field.Advance(dt);
    }
    
    participant.finalize();
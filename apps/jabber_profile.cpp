@@ -33,6 +33,10 @@ using dur_t = std::chrono::duration<double, std::micro>;
 void CreateGrid(const int dim, const int num_pts_d, const double extent, 
                   std::vector<double> &coords);
 
+/// Create a dummy structured grid, equivalent to \ref CreateGrid().
+StructuredGrid CreateStructuredGrid(const int dim, const int num_pts_d,
+                                    const double extent);
+
 int main(int argc, char *argv[])
 {
 #ifdef JABBER_WITH_MPI
@@ -68,6 +72,8 @@ int main(int argc, char *argv[])
                         cxxopts::value<int>()->default_value("10000"))
       ("w,warmup", "Number of warmup passes to Compute(), using randomized "
                    "times.", cxxopts::value<int>()->default_value("1000"))
+      ("s,structured", "Use a structured AcousticField, instead of the "
+                       "kernel in the config file.")
       ("h,help", "Print usage information.");
 
    cxxopts::ParseResult result = options.parse(argc, argv);
@@ -93,6 +99,7 @@ int main(int argc, char *argv[])
    const double extent = result["extent"].as<double>();
    const int passes = result["passes"].as<int>();
    const int warmup_passes = result["warmup"].as<int>();
+   const bool structured = result.count("structured") > 0;
 
    // Parse config file
    std::string config_file = result["config"].as<std::string>();
@@ -121,19 +128,34 @@ int main(int argc, char *argv[])
       std::cout << "\tSpacing: " << (extent/(num_pts_d-1.0)) << std::endl;
    }
 
-   // Create a simple [0,1]^dim grid
-   std::vector<double> coords(num_pts_total*dim);
-   CreateGrid(dim, num_pts_d, extent, coords);
+   // Create a simple [0,1]^dim grid + initialize AcousticField
+   AcousticField field = [&]()
+   {
+      if (structured)
+      {
+         StructuredGrid grid = CreateStructuredGrid(dim, num_pts_d, extent);
+#ifdef JABBER_WITH_MPI
+         // Partition along the first (slowest) axis.
+         const std::size_t begin = rank*grid.counts[0]/size;
+         const std::size_t end = (rank+1)*grid.counts[0]/size;
+         grid.origin[0] += begin*grid.spacing[0];
+         grid.counts[0] = end - begin;
+#endif // JABBER_WITH_MPI
+         return InitializeAcousticField(conf, grid, dim);
+      }
+
+      std::vector<double> coords(num_pts_total*dim);
+      CreateGrid(dim, num_pts_d, extent, coords);
 
 #ifdef JABBER_WITH_MPI
-   // Partition the coordinates.
-   std::span<const double> rank_coords;
-   GetRankPartition<double>(coords, dim, rank, size, rank_coords);
-   coords = std::vector<double>(rank_coords.begin(), rank_coords.end());
+      // Partition the coordinates.
+      std::span<const double> rank_coords;
+      GetRankPartition<double>(coords, dim, rank, size, rank_coords);
+      coords = std::vector<double>(rank_coords.begin(), rank_coords.end());
 #endif // JABBER_WITH_MPI
 
-   // Initialize AcousticField
-   AcousticField field = InitializeAcousticField(conf, coords, dim);
+      return InitializeAcousticField(conf, coords, dim);
+   }();
 
    // Create an array of randomized times
    std::mt19937 gen(0);
@@ -240,7 +262,7 @@ int main(int argc, char *argv[])
 
    RankData rank_data;
    rank_data.local_ave = local_ave_dur.count();
-   rank_data.num_pts = coords.size()/dim;
+   rank_data.num_pts = field.NumPoints();
 
    std::vector<RankData> all_rank_data;
    ROOT all_rank_data.resize(size);
@@ -339,3 +361,14 @@ void CreateGrid(const int dim, const int num_pts_d, const double extent,
       }
    }
 }
+
+StructuredGrid CreateStructuredGrid(const int dim, const int num_pts_d,
+                                    const double extent)
+{
+   const double h = extent/(num_pts_d-1);
+   StructuredGrid grid;
+   grid.origin.assign(dim, 0.0);
+   grid.spacing.assign(dim, h);
+   grid.counts.assign(dim, num_pts_d);
+   return grid;
+}
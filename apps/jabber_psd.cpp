@@ -94,10 +94,15 @@ int main(int argc, char *argv[])
    std::cout << LINE << std::endl;
    std::vector<double> coords = {0.1, 0.1, 0.1};
 
+   // Only the density is needed for the pressure perturbation
+   if (!conf.Comp().output_fields.has_value())
+   {
+      conf.Comp().output_fields = FieldBit(Field::Density);
+   }
+
    // Initialize AcousticField
    AcousticField field = InitializeAcousticField(conf, coords, 3);
 
-   double time = 0.0;
    const double c_sq = conf.BaseFlow().gamma*
                            conf.BaseFlow().p/conf.BaseFlow().rho;
 
@@ -107,8 +112,14 @@ int main(int argc, char *argv[])
    // Run through all times, storing pressures at each timestep
    for (int i = 0; i < nt; i++)
    {
-      field.Compute(time);
-      time += dt;
+      if (i == 0)
+      {
+         field.Compute(0.0);
+      }
+      else
+      {
+         field.Advance(dt);
+      }
       p_prime[i] = c_sq*(field.Density()[0] - conf.BaseFlow().rho);
       if (nd)
       {
@@ -364,18 +364,80 @@ void SourceVisitor::operator()
    ReadWaves(is, waves);
 }
 
-AcousticField InitializeAcousticField(const ConfigInput &conf, 
-                                       std::span<const double> coords,
-                                       int dim)
+namespace
+{
+
+/// Apply computation settings + sources of \p conf to \p field + finalize.
+void SetupAcousticField(const ConfigInput &conf, AcousticField &field)
 {
-   // Get relevant input metadata
    const BaseFlowParams &base_conf = conf.BaseFlow();
    const CompParams &comp_conf = conf.Comp();
    const std::vector<Source::ParamsVariant> &sources_conf = conf.Sources();
 
-   // Initialize acoustic field
-   AcousticField field(dim, coords, base_conf.p, base_conf.rho,
-                        base_conf.U, base_conf.gamma, comp_conf.kernel);
+   if (comp_conf.engine.has_value())
+   {
+      field.SetEngine(*comp_conf.engine);
+   }
+   if (comp_conf.resync_interval.has_value())
+   {
+      field.SetResyncInterval(*comp_conf.resync_interval);
+   }
+   if (comp_conf.tile_size.has_value())
+   {
+      field.SetTileSize(*comp_conf.tile_size);
+   }
+   if (comp_conf.mixed_precision.has_value())
+   {
+      field.SetMixedPrecision(*comp_conf.mixed_precision);
+   }
+   if (comp_conf.deterministic.has_value())
+   {
+      field.SetDeterministic(*comp_conf.deterministic);
+   }
+   if (comp_conf.output_fields.has_value())
+   {
+      field.SetOutputFields(*comp_conf.output_fields);
+   }
+   if (comp_conf.output_variables.has_value())
+   {
+      field.SetOutputVariables(*comp_conf.output_variables);
+   }
+   if (comp_conf.accuracy.has_value())
+   {
+      field.SetCosineAccuracy(*comp_conf.accuracy);
+   }
+   if (comp_conf.nufft_tolerance.has_value())
+   {
+      field.SetNUFFTTolerance(*comp_conf.nufft_tolerance);
+   }
+   if (comp_conf.expansion_tolerance.has_value())
+   {
+      field.SetExpansionTolerance(*comp_conf.expansion_tolerance);
+   }
+   if (comp_conf.low_rank_tolerance.has_value())
+   {
+      field.SetLowRankTolerance(*comp_conf.low_rank_tolerance);
+   }
+   if (comp_conf.multi_rate_tolerance.has_value())
+   {
+      field.SetMultiRateTolerance(*comp_conf.multi_rate_tolerance);
+   }
+   if (comp_conf.snapshot_count.has_value())
+   {
+      field.SetSnapshotCount(*comp_conf.snapshot_count);
+   }
+   if (comp_conf.snapshot_memory.has_value())
+   {
+      field.SetSnapshotMemory(*comp_conf.snapshot_memory);
+   }
+   if (comp_conf.snapshot_order.has_value())
+   {
+      field.SetSnapshotOrder(*comp_conf.snapshot_order);
+   }
+   if (comp_conf.autotune_cache.has_value())
+   {
+      field.SetAutotuneCachePath(*comp_conf.autotune_cache);
+   }
 
    // Assemble vector of wave structs based on input source
    for (const Source::ParamsVariant &source : sources_conf)
@@ -385,10 +447,39 @@ AcousticField InitializeAcousticField(const ConfigInput &conf,
 
    // Finalize the acoustic field initialization
    field.Finalize();
+}
+
+} // namespace
+
+AcousticField InitializeAcousticField(const ConfigInput &conf, 
+                                       std::span<const double> coords,
+                                       int dim)
+{
+   const BaseFlowParams &base_conf = conf.BaseFlow();
+   const CompParams &comp_conf = conf.Comp();
+
+   // Initialize acoustic field
+   AcousticField field(dim, coords, base_conf.p, base_conf.rho,
+                        base_conf.U, base_conf.gamma, comp_conf.kernel);
+   SetupAcousticField(conf, field);
 
    return std::move(field);
 
-}                                        
+}
+
+AcousticField InitializeAcousticField(const ConfigInput &conf, 
+                                       const StructuredGrid &grid,
+                                       int dim)
+{
+   const BaseFlowParams &base_conf = conf.BaseFlow();
+
+   // Initialize acoustic field
+   AcousticField field(dim, grid, base_conf.p, base_conf.rho,
+                        base_conf.U, base_conf.gamma);
+   SetupAcousticField(conf, field);
+
+   return std::move(field);
+}
 
 } // namespace app
 } // namespace jabber
@@ -165,6 +165,19 @@ AcousticField InitializeAcousticField(const ConfigInput &conf,
                                                 std::span<const double> coords,
                                                 int dim);
 
+/**
+ * @brief Initialize a \ref AcousticField object from user input and
+ * structured grid. The kernel in \p conf is not used.
+ * 
+ * @param conf          Input config object.
+ * @param grid          Structured grid.
+ * @param dim           Spatial dimension of grid.
+ * @return AcousticField    Finalized acoustic field.
+ */
+AcousticField InitializeAcousticField(const ConfigInput &conf, 
+                                       const StructuredGrid &grid,
+                                       int dim);
+
 
 /**
  * @brief Extremely simple function to get subspan of data from \p global 
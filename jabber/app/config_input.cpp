@@ -6,6 +6,8 @@
 #include <format>
 #include <sstream>
 #include <algorithm>
+#include <limits>
+#include <utility>
 
 // Helper type for the std::visit
 // (https://en.cppreference.com/w/cpp/utility/variant/visit)
@@ -388,10 +390,46 @@ void ConfigInput::PrintCompParams(std::ostream &out) const
 {
    out << "Computation" << std::endl;
 
+   std::vector<std::string> field_names;
+   const FieldMask fields = comp_.output_fields.value_or(kAllFields);
+   for (std::size_t f = 0; f < FieldType::kNames.size(); f++)
+   {
+      if (HasField(fields, static_cast<Field>(f)))
+      {
+         field_names.emplace_back(FieldType::kNames[f]);
+      }
+   }
+
    const std::vector<PV> params
    ({  
-      {"t0",      ToString(comp_.t0)},
-      {"Kernel",  GetName<KernelType>(comp_.kernel)}
+      {"t0",               ToString(comp_.t0)},
+      {"Kernel",           GetName<KernelType>(comp_.kernel)},
+      {"Engine",           comp_.engine.value_or("None")},
+      {"Resync Interval",  ToString(comp_.resync_interval.value_or(
+                              AcousticField::kDefaultResyncInterval))},
+      {"Tile Size",        ToString(comp_.tile_size.value_or(
+                              kDefaultTileSize))},
+      {"Mixed Precision",  ToString(comp_.mixed_precision.value_or(false))},
+      {"Deterministic",    ToString(comp_.deterministic.value_or(false))},
+      {"Output Fields",    ToString(field_names)},
+      {"Output Variables", GetName<VariablesType>(
+                              comp_.output_variables.value_or(
+                                 Variables::Conservative))},
+      {"Accuracy",         GetName<AccuracyType>(comp_.accuracy.value_or(
+                              Accuracy::Exact))},
+      {"NUFFT Tolerance",  ToString(comp_.nufft_tolerance.value_or(
+                              AcousticField::kDefaultNUFFTTolerance))},
+      {"Expansion Tolerance", ToString(comp_.expansion_tolerance.value_or(
+                              AcousticField::kDefaultExpansionTolerance))},
+      {"Low-Rank Tolerance", ToString(comp_.low_rank_tolerance.value_or(
+                              AcousticField::kDefaultLowRankTolerance))},
+      {"Multi-Rate Tolerance", ToString(comp_.multi_rate_tolerance.value_or(
+                              AcousticField::kDefaultMultiRateTolerance))},
+      {"Snapshot Count",   ToString(comp_.snapshot_count.value_or(0))},
+      {"Snapshot Memory",  ToString(comp_.snapshot_memory.value_or(
+                              AcousticField::kDefaultSnapshotMemory))},
+      {"Snapshot Order",   ToString(comp_.snapshot_order.value_or(0))},
+      {"Autotune Cache",   comp_.autotune_cache.value_or("None")}
    });
 
    out << PrintParams(params) << std::endl;
@@ -448,6 +486,32 @@ T::Option GetOption(const std::string &name)
    return option;
 }
 
+/// Internal helper function here for getting non-negative \p key in \p T.
+template<typename T>
+T GetNonNegative(const toml::value &in_val, const std::string &key)
+{
+   const std::int64_t val = in_val.at(key).as_integer();
+   if (val < 0 || std::cmp_greater(val, std::numeric_limits<T>::max()))
+   {
+      throw std::invalid_argument(std::format("Invalid input argument: "
+                                              "{}={}", key, val));
+   }
+   return static_cast<T>(val);
+}
+
+/// Internal helper function here for getting positive \p key in \p T.
+template<typename T>
+T GetPositive(const toml::value &in_val, const std::string &key)
+{
+   const std::int64_t val = in_val.at(key).as_integer();
+   if (val <= 0 || std::cmp_greater(val, std::numeric_limits<T>::max()))
+   {
+      throw std::invalid_argument(std::format("Invalid input argument: "
+                                              "{}={}", key, val));
+   }
+   return static_cast<T>(val);
+}
+
 void TOMLConfigInput::ParseInputXY
    (std::string toml_string, InputXY::ParamsVariant &opv)
 {
@@ -676,6 +740,81 @@ void TOMLConfigInput::ParseComputation
    toml::value in_val = toml::parse_str(toml_string);
    op.t0 = in_val.at("t0").as_floating();
    op.kernel = GetOption<KernelType>(in_val.at("Kernel").as_string());
+   if (op.kernel == KernelType::Custom)
+   {
+      op.engine = in_val.at("Engine").as_string();
+   }
+   if (in_val.contains("ResyncInterval"))
+   {
+      op.resync_interval = GetPositive<int>(in_val, "ResyncInterval");
+   }
+   if (in_val.contains("TileSize"))
+   {
+      op.tile_size = GetPositive<std::size_t>(in_val, "TileSize");
+   }
+   if (in_val.contains("MixedPrecision"))
+   {
+      op.mixed_precision = in_val.at("MixedPrecision").as_boolean();
+   }
+   if (in_val.contains("Deterministic"))
+   {
+      op.deterministic = in_val.at("Deterministic").as_boolean();
+   }
+   if (in_val.contains("OutputFields"))
+   {
+      const std::vector<std::string> field_strs = 
+            toml::get<std::vector<std::string>>(in_val.at("OutputFields"));
+      op.output_fields = 0;
+      for (const std::string &field_str : field_strs)
+      {
+         *op.output_fields |= FieldBit(GetOption<FieldType>(field_str));
+      }
+   }
+   if (in_val.contains("OutputVariables"))
+   {
+      op.output_variables = GetOption<VariablesType>(
+                                 in_val.at("OutputVariables").as_string());
+   }
+   if (in_val.contains("Accuracy"))
+   {
+      op.accuracy = GetOption<AccuracyType>(in_val.at("Accuracy").as_string());
+   }
+   if (in_val.contains("NUFFTTolerance"))
+   {
+      op.nufft_tolerance = in_val.at("NUFFTTolerance").as_floating();
+   }
+   if (in_val.contains("ExpansionTolerance"))
+   {
+      op.expansion_tolerance = 
+                        in_val.at("ExpansionTolerance").as_floating();
+   }
+   if (in_val.contains("LowRankTolerance"))
+   {
+      op.low_rank_tolerance = in_val.at("LowRankTolerance").as_floating();
+   }
+   if (in_val.contains("MultiRateTolerance"))
+   {
+      op.multi_rate_tolerance = 
+                        in_val.at("MultiRateTolerance").as_floating();
+   }
+   if (in_val.contains("SnapshotCount"))
+   {
+      op.snapshot_count = GetNonNegative<std::size_t>(in_val, 
+                                                      "SnapshotCount");
+   }
+   if (in_val.contains("SnapshotMemory"))
+   {
+      op.snapshot_memory = GetNonNegative<std::size_t>(in_val, 
+                                                      "SnapshotMemory");
+   }
+   if (in_val.contains("SnapshotOrder"))
+   {
+      op.snapshot_order = GetNonNegative<int>(in_val, "SnapshotOrder");
+   }
+   if (in_val.contains("AutotuneCache"))
+   {
+      op.autotune_cache = in_val.at("AutotuneCache").as_string();
+   }
 }
 
 void TOMLConfigInput::ParsePrecice
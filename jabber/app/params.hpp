@@ -9,6 +9,7 @@
 #include <variant>
 #include <array>
 #include <optional>
+#include <algorithm>
 
 namespace jabber
 {
@@ -519,12 +520,82 @@ struct KernelType
 
    using enum Option;
 
+   /**
+    * @brief Names of the built-in engines of EngineRegistry, followed by 
+    * "Auto" and "Custom".
+    */
+   static constexpr std::array<std::string_view, 
+                  static_cast<std::size_t>(Size)>
+   kNames = []()
+   {
+      std::array<std::string_view, static_cast<std::size_t>(Size)> names;
+      std::ranges::copy(EngineRegistry::kBuiltinNames, names.begin());
+      names[static_cast<std::size_t>(Auto)] = "Auto";
+      names[static_cast<std::size_t>(Custom)] = "Custom";
+      return names;
+   }();
+
+};
+
+// ----------------------------------------------------------------------------
+/**
+ * @brief All options associated with cosine accuracy selection.
+ */
+struct AccuracyType
+{
+   using Option = Accuracy;
+
+   using enum Option;
+
    static constexpr std::array<std::string_view, 
                   static_cast<std::size_t>(Size)>
    kNames = 
    {
-      "GridPoint",      // AcousticField::Kernel::GridPoint
-      "Wave",           // AcousticField::Kernel::Wave
+      "Exact",          // Accuracy::Exact
+      "1e-10",          // Accuracy::High
+      "1e-6",           // Accuracy::Low
+   };
+
+};
+
+// ----------------------------------------------------------------------------
+/**
+ * @brief All options associated with output field selection.
+ */
+struct FieldType
+{
+   using Option = Field;
+
+   using enum Option;
+
+   static constexpr std::array<std::string_view, 
+                  static_cast<std::size_t>(Size)>
+   kNames = 
+   {
+      "Density",        // Field::Density
+      "Momentum",       // Field::Momentum
+      "Energy",         // Field::Energy
+   };
+
+};
+
+// ----------------------------------------------------------------------------
+/**
+ * @brief All options associated with output variables selection.
+ */
+struct VariablesType
+{
+   using Option = Variables;
+
+   using enum Option;
+
+   static constexpr std::array<std::string_view, 
+                  static_cast<std::size_t>(Size)>
+   kNames = 
+   {
+      "Conservative",   // Variables::Conservative
+      "Primitive",      // Variables::Primitive
+      "Linearized",     // Variables::Linearized
    };
 
 };
@@ -538,6 +609,102 @@ struct CompParams
 
    /// Kernel type.
    AcousticField::Kernel kernel;
+
+   /**
+    * @brief Name of the registered engine of AcousticField::Kernel::Custom,
+    * resolved by EngineRegistry at runtime. Only set if Custom.
+    */
+   std::optional<std::string> engine;
+
+   /**
+    * @brief Number of AcousticField::Advance() calls between exact
+    * evaluations. Default used if not set.
+    */
+   std::optional<int> resync_interval;
+
+   /**
+    * @brief Number of points per tile for AcousticField::Kernel::GridPoint.
+    * Default used if not set.
+    */
+   std::optional<std::size_t> tile_size;
+
+   /**
+    * @brief Whether AcousticField::Kernel::GridPoint is evaluated in mixed
+    * precision. Default (false) used if not set.
+    */
+   std::optional<bool> mixed_precision;
+
+   /**
+    * @brief Whether AcousticField::Kernel::GridPoint sums in a 
+    * deterministic order. Default (false) used if not set.
+    */
+   std::optional<bool> deterministic;
+
+   /**
+    * @brief Conservative variables to compute. Default (all) used if not 
+    * set.
+    */
+   std::optional<FieldMask> output_fields;
+
+   /**
+    * @brief Form of the computed variables. Default (conservative) used if
+    * not set.
+    */
+   std::optional<Variables> output_variables;
+
+   /**
+    * @brief Accuracy of cosines in AcousticField::Kernel::GridPoint and
+    * AcousticField::Kernel::Wave. Default (exact) used if not set.
+    */
+   std::optional<Accuracy> accuracy;
+
+   /**
+    * @brief Relative tolerance of AcousticField::Kernel::NUFFT. Default used
+    * if not set.
+    */
+   std::optional<double> nufft_tolerance;
+
+   /**
+    * @brief Relative tolerance of AcousticField::Kernel::TileExpansion. 
+    * Default used if not set.
+    */
+   std::optional<double> expansion_tolerance;
+
+   /**
+    * @brief Relative tolerance of AcousticField::Kernel::LowRank. Default 
+    * used if not set.
+    */
+   std::optional<double> low_rank_tolerance;
+
+   /**
+    * @brief Relative tolerance of AcousticField::Kernel::MultiRate. Default 
+    * used if not set.
+    */
+   std::optional<double> multi_rate_tolerance;
+
+   /**
+    * @brief Number of snapshots precomputed over the period of a periodic 
+    * field. None precomputed if not set.
+    */
+   std::optional<std::size_t> snapshot_count;
+
+   /**
+    * @brief Memory budget, in bytes, of the snapshots. Default used if not 
+    * set.
+    */
+   std::optional<std::size_t> snapshot_memory;
+
+   /**
+    * @brief Degree of the interpolation between snapshots. Default (none) 
+    * used if not set.
+    */
+   std::optional<int> snapshot_order;
+
+   /**
+    * @brief Path to the cache of AcousticField::Kernel::Auto. No cache used
+    * if not set.
+    */
+   std::optional<std::string> autotune_cache;
 };
 
 // ----------------------------------------------------------------------------
@@ -1,12 +1,20 @@
 #include "acoustic_field.hpp"
 #include "kernels.hpp"
+#include "engine.hpp"
+#include "autotune.hpp"
 
 #include <math.h>
 #include <numeric>
+#include <algorithm>
+#include <map>
+#include <limits>
 #include <iostream>
 #include <format>
 #include <string>
 #include <ranges>
+#include <cstdint>
+#include <chrono>
+#include <optional>
 
 namespace jabber
 {
@@ -71,33 +79,197 @@ AcousticField::AcousticField(int dim, std::span<const double> coords,
   U_bar_(U_bar),
   gamma_(gamma),
   c_bar_(std::sqrt(gamma_*p_bar_/rho_bar_)),
-  coords_(dim_)
+  engine_name_(kernel < Kernel::Auto ? 
+                  EngineRegistry::kBuiltinNames[static_cast<int>(kernel)] :
+                  ""),
+  autotune_(kernel == Kernel::Auto),
+  coords_(dim_*num_pts_)
 {
    
    // Store the coordinates in an SoA-style
    for (int d = 0; d < Dim(); d++)
    {
-      coords_[d].resize(NumPoints());
       for (int i = 0; i < NumPoints(); i++)
       {
-         coords_[d][i] = coords[i*Dim() + d];
+         coords_[d*NumPoints() + i] = coords[i*Dim() + d];
       }
    }
 }
 
+static_assert(EngineRegistry::kBuiltinNames.size() == 
+                  static_cast<std::size_t>(AcousticField::Kernel::Auto),
+               "Each kernel other than Auto must have a built-in engine");
+
+namespace
+{
+
+/// Validate \p grid for dimension \p dim and get its number of points.
+std::size_t NumGridPoints(int dim, const StructuredGrid &grid)
+{
+   const std::size_t num_dims = dim;
+   if (grid.origin.size() != num_dims || grid.spacing.size() != num_dims ||
+         grid.counts.size() != num_dims)
+   {
+      throw std::invalid_argument("Structured grid must be sized by the "
+                                    "dimension.");
+   }
+   std::size_t num_pts = 1;
+   for (const std::size_t n : grid.counts)
+   {
+      if (n < 1)
+      {
+         throw std::invalid_argument("Structured grid must have at least "
+                                       "one point along each axis.");
+      }
+      num_pts *= n;
+   }
+   return num_pts;
+}
+
+/// Relative tolerance of each frequency in \ref CommonPeriod().
+constexpr double kPeriodTolerance = 1e-10;
+
+/// Maximum ratio of any frequency to the fundamental in \ref CommonPeriod().
+constexpr double kMaxHarmonic = 1e6;
+
+/**
+ * @brief Get the common period of \p waves, such that each nonzero 
+ * frequency is an integer multiple of its inverse to within 
+ * \ref kPeriodTolerance, or zero if none.
+ */
+double CommonPeriod(std::span<const Wave> waves)
+{
+   double f_max = 0.0;
+   for (const Wave &w : waves)
+   {
+      f_max = std::max(f_max, std::abs(w.frequency));
+   }
+   if (f_max == 0.0)
+   {
+      return 0.0;
+   }
+
+   // Euclid's algorithm, with remainders within rounding of zero or of the
+   // divisor taken as zero
+   const double tol = kPeriodTolerance*f_max;
+   double f_0 = 0.0;
+   for (const Wave &w : waves)
+   {
+      double a = std::abs(w.frequency);
+      double b = f_0;
+      if (a == 0.0)
+      {
+         continue;
+      }
+      while (b > tol)
+      {
+         double r = std::fmod(a, b);
+         if (r > b - tol)
+         {
+            r = 0.0;
+         }
+         a = b;
+         b = r;
+      }
+      f_0 = a;
+   }
+
+   if (f_max > kMaxHarmonic*f_0)
+   {
+      return 0.0;
+   }
+   for (const Wave &w : waves)
+   {
+      const double f = std::abs(w.frequency);
+      if (std::abs(f - std::round(f/f_0)*f_0) > kPeriodTolerance*f)
+      {
+         return 0.0;
+      }
+   }
+   return 1.0/f_0;
+}
+
+/// Maximum number of points sampled by \ref AcousticField::Autotune().
+constexpr std::size_t kAutotunePoints = 8192;
+
+/**
+ * @brief Number of timed evaluations of each candidate in
+ * \ref AcousticField::Autotune(), after an untimed warm-up evaluation.
+ */
+constexpr int kAutotuneRepeats = 3;
+
+/// Tile sizes of Kernel::GridPoint timed in \ref AcousticField::Autotune().
+constexpr std::size_t kAutotuneTileSizes[] = {128, 512, 2048};
+
+} // namespace
+
+AcousticField::AcousticField(int dim, const StructuredGrid &grid,
+                  double p_bar, double rho_bar,
+                  const std::vector<double> U_bar, double gamma)
+: dim_(dim),
+  num_pts_(NumGridPoints(dim, grid)),
+  p_bar_(p_bar),
+  rho_bar_(rho_bar),
+  U_bar_(U_bar),
+  gamma_(gamma),
+  c_bar_(std::sqrt(gamma_*p_bar_/rho_bar_)),
+  kernel_(Kernel::Phasor),
+  engine_name_(EngineRegistry::kBuiltinNames[static_cast<int>(kernel_)]),
+  grid_(grid)
+{
+}
+
 void AcousticField::Finalize()
 {
+   // Group waves by direction, ordering each group's waves contiguously
+   std::vector<int> wave_order(NumWaves());
+   std::vector<int> wave_groups(NumWaves());
+   std::map<std::vector<double>, int> group_ids;
+   for (int w = 0; w < NumWaves(); w++)
+   {
+      const std::vector<double> &k_hat = Waves()[w].k_hat;
+      const auto [it, inserted] = group_ids.try_emplace(
+                           std::vector<double>(k_hat.begin(), 
+                                                k_hat.begin() + Dim()),
+                           static_cast<int>(group_ids.size()));
+      wave_groups[w] = it->second;
+   }
+   std::iota(wave_order.begin(), wave_order.end(), 0);
+   std::stable_sort(wave_order.begin(), wave_order.end(),
+                     [&](const int a, const int b)
+                     { return wave_groups[a] < wave_groups[b]; });
+
+   const int num_groups = group_ids.size();
+   kernel_args_.group_offsets.assign(num_groups + 1, 0);
+   kernel_args_.group_k_hats.resize(num_groups*Dim());
+   for (const auto &[k_hat, g] : group_ids)
+   {
+      std::copy(k_hat.begin(), k_hat.end(), 
+                  kernel_args_.group_k_hats.begin() + g*Dim());
+   }
+   for (int w = 0; w < NumWaves(); w++)
+   {
+      kernel_args_.group_offsets[wave_groups[w]+1]++;
+   }
+   std::partial_sum(kernel_args_.group_offsets.begin(), 
+                     kernel_args_.group_offsets.end(),
+                     kernel_args_.group_offsets.begin());
+
    // Allocate non-time-varying constants
    kernel_args_.rho_coeffs.resize(NumWaves());
    kernel_args_.rhoV_coeffs.resize(Dim()*NumWaves());
    kernel_args_.rhoE_coeffs.resize(NumWaves());
    kernel_args_.wave_omegas.resize(NumWaves());
-   kernel_args_.k_dot_x_p_phi.resize(NumWaves()*NumPoints());
+   kernel_args_.wave_ks.resize(Dim()*NumWaves());
+   kernel_args_.wave_k_mags.resize(NumWaves());
+   kernel_args_.wave_phases.resize(NumWaves());
+   kernel_args_.wave_amps.resize(NumWaves());
+   kernel_args_.wave_speeds.resize(NumWaves());
 
    // Note that performance of below was not carefully considered
    for (int w = 0; w < NumWaves(); w++)
    {
-      const Wave &wave = Waves()[w];
+      const Wave &wave = Waves()[wave_order[w]];
 
       kernel_args_.rho_coeffs[w] = wave.amplitude/(c_bar_*c_bar_);
       kernel_args_.rhoE_coeffs[w] = wave.amplitude/(gamma_ - 1.0);
@@ -113,77 +285,498 @@ void AcousticField::Finalize()
             speed_encoder*wave.k_hat[d]*wave.amplitude/(rho_bar_*c_bar_);
       }
 
-      // Compute magnitude of wavelength vector k
+      // Compute magnitude of wavelength vector k + set wavenumber vector
       const double k = kernel_args_.wave_omegas[w]/denom;
-
-      // Compute + set k·x+φ
-      for (std::size_t i = 0; i < NumPoints(); i++)
-      {  
-         const std::size_t idx = 
-         [&]()
-         {
-            switch (kernel_)
-            {
-               case Kernel::GridPoint:
-                  return w*NumPoints() + i;
-                  break;
-               case Kernel::Wave:
-                  return i*NumWaves() + w;
-                  break;
-               default:
-                  throw std::logic_error("Unimplemented kernel type!");
-            }
-         }();
-         kernel_args_.k_dot_x_p_phi[idx] = wave.phase;
-         for (int d = 0; d < Dim(); d++)
-         {
-            kernel_args_.k_dot_x_p_phi[idx] += 
-                                    wave.k_hat[d]*k*coords_[d][i];
-         }
+      for (int d = 0; d < Dim(); d++)
+      {
+         kernel_args_.wave_ks[d*NumWaves() + w] = wave.k_hat[d]*k;
       }
+      kernel_args_.wave_k_mags[w] = k;
+      kernel_args_.wave_phases[w] = wave.phase;
+      kernel_args_.wave_amps[w] = wave.amplitude;
+      kernel_args_.wave_speeds[w] = wave.speed;
+   }
+
+   // Resolve the engine, and wrap it in the automatic paths
+   if (autotune_)
+   {
+      Autotune();
+   }
+   if (engine_name_.empty())
+   {
+      throw std::invalid_argument("No compute engine selected for "
+                                    "Kernel::Custom, see SetEngine().");
+   }
+   engine_ = EngineRegistry::Create(engine_name_, *this);
+   const EngineCapabilities caps = engine_->Capabilities();
+   if (!caps.SupportsDim(Dim()))
+   {
+      throw std::invalid_argument(std::format("Compute engine {} does not "
+                                    "support dimension {}.", engine_name_, 
+                                    Dim()));
+   }
+   if (IsStructured() && !caps.structured)
+   {
+      throw std::invalid_argument(std::format("Compute engine {} does not "
+                                    "support structured grids.", 
+                                    engine_name_));
    }
+   engine_ = WrapAutomaticPaths(*this, std::move(engine_));
+
+   // Precompute any per-point data, of whichever path applies
+   engine_->Finalize(Series());
 
    // Allocate flow solution memory
    rho_.resize(NumPoints());
    rhoV_.resize(NumPoints()*Dim());
    rhoE_.resize(NumPoints());
+
+   // Precompute snapshots over one period, if periodic and within budget
+   // (by division, as the product of the count and size may overflow)
+   snapshots_.clear();
+   period_ = CommonPeriod(Waves());
+   const std::size_t snapshot_size = (Dim() + 2)*NumPoints();
+   if (period_ > 0.0 && snapshot_size > 0 && snapshot_count_ > 
+                           static_cast<std::size_t>(snapshot_order_) &&
+         snapshot_count_ <= snapshot_memory_/sizeof(double)/snapshot_size)
+   {
+      std::vector<double> snapshots(snapshot_count_*snapshot_size);
+      for (std::size_t m = 0; m < snapshot_count_; m++)
+      {
+         Compute(m*period_/snapshot_count_);
+         double *snapshot = snapshots.data() + m*snapshot_size;
+         snapshot = std::ranges::copy(rho_, snapshot).out;
+         snapshot = std::ranges::copy(rhoV_, snapshot).out;
+         std::ranges::copy(rhoE_, snapshot);
+      }
+      snapshots_ = std::move(snapshots);
+   }
 }
 
 void AcousticField::Compute(double t)
 {
-   // Dispatch to appropriate kernel
+   if (UsesSnapshots() && InterpolateSnapshots(t))
+   {
+      time_ = t;
+      steps_since_sync_ = 0;
+      advance_steps_ = 0;
+      return;
+   }
+   ResetTime(t);
+   EvaluateKernel(t);
+}
+
+bool AcousticField::InterpolateSnapshots(double t)
+{
+   // Position of t within the period, in units of the snapshot spacing, 
+   // with times within rounding of a snapshot taken as at it
+   const long count = snapshot_count_;
+   const double periods = t/period_;
+   const double s = (periods - std::floor(periods))*count;
+   const double tol = 16*std::numeric_limits<double>::epsilon()*count*
+                        (1.0 + std::abs(periods));
+   const bool on_snapshot = std::abs(s - std::round(s)) <= tol;
+   if (!on_snapshot && snapshot_order_ == 0)
+   {
+      return false;
+   }
+
+   // Lagrange weights of the order + 1 nearest snapshots, wrapping around
+   // the period
+   const int num_snaps = on_snapshot ? 1 : snapshot_order_ + 1;
+   const long first = on_snapshot || num_snaps % 2 == 1 ? 
+                        std::lround(s) - num_snaps/2 : 
+                        static_cast<long>(std::floor(s)) - (num_snaps/2 - 1);
+   std::vector<double> weights(num_snaps, 1.0);
+   std::vector<long> idxs(num_snaps);
+   for (int j = 0; j < num_snaps; j++)
+   {
+      idxs[j] = ((first + j) % count + count) % count;
+      for (int i = 0; i < num_snaps && !on_snapshot; i++)
+      {
+         if (i != j)
+         {
+            weights[j] *= (s - (first + i))/(j - i);
+         }
+      }
+   }
+
+   // Interpolate each variable
+   const std::size_t snapshot_size = (Dim() + 2)*NumPoints();
+   std::vector<const double*> snapshots(num_snaps);
+   const auto interpolate = [&](std::size_t offset, std::vector<double> &out)
+   {
+      for (int j = 0; j < num_snaps; j++)
+      {
+         snapshots[j] = snapshots_.data() + idxs[j]*snapshot_size + offset;
+      }
+      InterpolateSnapshotsKernel(out.size(), num_snaps, snapshots.data(), 
+                                 weights.data(), out.data());
+   };
+   interpolate(0, rho_);
+   interpolate(NumPoints(), rhoV_);
+   interpolate((Dim() + 1)*NumPoints(), rhoE_);
+   return true;
+}
+
+void AcousticField::ComputeBatch(std::span<const double> times, 
+                                 std::span<double> rho, 
+                                 std::span<double> rhoV,
+                                 std::span<double> rhoE)
+{
+   const std::size_t num_times = times.size();
+   if (rho.size() != num_times*NumPoints() || 
+         rhoV.size() != num_times*Dim()*NumPoints() ||
+         rhoE.size() != num_times*NumPoints())
+   {
+      throw std::invalid_argument("Output sizes do not match number of "
+                                    "times and points");
+   }
+   if (num_times == 0)
+   {
+      return;
+   }
+
+   if (!UsesSnapshots())
+   {
+      engine_->ComputeBatch(Series(), num_times, times.data(), rho.data(),
+                              rhoV.data(), rhoE.data());
+      if (!engine_->Capabilities().variables)
+      {
+         for (std::size_t t = 0; t < num_times; t++)
+         {
+            ConvertVariables(rho.data() + t*NumPoints(), 
+                              rhoV.data() + t*Dim()*NumPoints(),
+                              rhoE.data() + t*NumPoints());
+         }
+      }
+
+      // Leave field as computed at the last time
+      ResetTime(times.back());
+      const std::size_t last = num_times - 1;
+      std::copy_n(rho.begin() + last*NumPoints(), NumPoints(), rho_.begin());
+      std::copy_n(rhoV.begin() + last*Dim()*NumPoints(), Dim()*NumPoints(), 
+                  rhoV_.begin());
+      std::copy_n(rhoE.begin() + last*NumPoints(), NumPoints(), 
+                  rhoE_.begin());
+      return;
+   }
+
+   for (std::size_t t = 0; t < num_times; t++)
+   {
+      Compute(times[t]);
+      std::ranges::copy(rho_, rho.begin() + t*NumPoints());
+      std::ranges::copy(rhoV_, rhoV.begin() + t*Dim()*NumPoints());
+      std::ranges::copy(rhoE_, rhoE.begin() + t*NumPoints());
+   }
+}
+
+void AcousticField::ResetTime(double t)
+{
+   time_ = t;
+   steps_since_sync_ = 0;
+   advance_steps_ = 0;
+
+   // Evaluate any time-dependent data exactly
+   engine_->Prepare(Series(), t);
+}
+
+void AcousticField::Advance(double dt)
+{
+   // Update the time, only restarting its count if timestep has changed
+   const bool new_dt = (dt != advance_dt_ || advance_steps_ == 0);
+   if (new_dt)
+   {
+      advance_t0_ = time_;
+      advance_steps_ = 0;
+      advance_dt_ = dt;
+   }
+   advance_steps_++;
+   const double t = advance_t0_ + advance_steps_*advance_dt_;
+
+   // Resync (or no recurrence to use)
+   const bool advances = !UsesSnapshots() && 
+                           engine_->Capabilities().advances;
+   if (!advances || ++steps_since_sync_ >= resync_interval_)
+   {
+      const std::size_t advance_steps = advance_steps_;
+      Compute(t);
+      advance_steps_ = advance_steps;
+      return;
+   }
+
+   time_ = t;
+   engine_->Advance(Series(), advance_dt_);
+   EvaluateKernel(time_);
+}
+
+void AcousticField::SetResyncInterval(int interval)
+{
+   if (interval < 1)
+   {
+      throw std::invalid_argument("Resync interval must be >= 1.");
+   }
+   resync_interval_ = interval;
+}
+
+void AcousticField::SetTileSize(std::size_t tile_size)
+{
+   if (tile_size < 1)
+   {
+      throw std::invalid_argument("Tile size must be >= 1.");
+   }
+   tile_size_ = tile_size;
+}
+
+void AcousticField::SetOutputFields(FieldMask fields)
+{
+   if (fields == 0 || fields > kAllFields)
+   {
+      throw std::invalid_argument("Output fields must be a nonzero mask.");
+   }
+   fields_ = fields;
+}
+
+void AcousticField::SetNUFFTTolerance(double tol)
+{
+   if (!(tol > 0.0 && tol < 1.0))
+   {
+      throw std::invalid_argument("NUFFT tolerance must be in (0,1).");
+   }
+   nufft_tolerance_ = tol;
+}
+
+void AcousticField::SetExpansionTolerance(double tol)
+{
+   if (!(tol > 0.0 && tol < 1.0))
+   {
+      throw std::invalid_argument("Expansion tolerance must be in (0,1).");
+   }
+   expansion_tolerance_ = tol;
+}
+
+void AcousticField::SetLowRankTolerance(double tol)
+{
+   if (!(tol > 0.0 && tol < 1.0))
+   {
+      throw std::invalid_argument("Low-rank tolerance must be in (0,1).");
+   }
+   low_rank_tolerance_ = tol;
+}
+
+void AcousticField::SetMultiRateTolerance(double tol)
+{
+   if (!(tol > 0.0 && tol < 1.0))
+   {
+      throw std::invalid_argument("Multi-rate tolerance must be in (0,1).");
+   }
+   multi_rate_tolerance_ = tol;
+}
+
+void AcousticField::SetSnapshotOrder(int order)
+{
+   if (order < 0)
+   {
+      throw std::invalid_argument("Snapshot order must be >= 0.");
+   }
+   snapshot_order_ = order;
+}
+
+bool AcousticField::IsCandidate(const EngineCapabilities &caps) const
+{
+   return caps.autotuned && caps.SupportsDim(Dim()) && 
+            (!IsStructured() || caps.structured);
+}
+
+void AcousticField::SetEngine(std::string name)
+{
+   SelectEngine(std::move(name));
+   autotune_ = false;
+}
+
+void AcousticField::SelectEngine(std::string name)
+{
+   if (!EngineRegistry::Contains(name))
+   {
+      throw std::invalid_argument(std::format("Unknown compute engine: {}", 
+                                                name));
+   }
+   const auto it = std::ranges::find(EngineRegistry::kBuiltinNames, name);
+   kernel_ = (it == EngineRegistry::kBuiltinNames.end()) ? Kernel::Custom :
+               static_cast<Kernel>(it - EngineRegistry::kBuiltinNames.begin());
+   engine_name_ = std::move(name);
+}
+
+std::size_t AcousticField::EngineMemory() const
+{
+   return engine_->MemoryEstimate(Series());
+}
+
+WaveSeries AcousticField::Series() const
+{
+   return WaveSeries{Dim(), NumPoints(), rho_bar_, p_bar_, U_bar_.data(), 
+                     gamma_, NumWaves(), 
+                     kernel_args_.rho_coeffs.data(),
+                     kernel_args_.rhoV_coeffs.data(),
+                     kernel_args_.rhoE_coeffs.data(),
+                     kernel_args_.wave_omegas.data(),
+                     kernel_args_.wave_ks.data(),
+                     kernel_args_.wave_phases.data(),
+                     kernel_args_.wave_k_mags.data(),
+                     kernel_args_.wave_amps.data(),
+                     kernel_args_.wave_speeds.data(),
+                     static_cast<int>(kernel_args_.group_offsets.size()) - 1,
+                     kernel_args_.group_offsets.data(),
+                     kernel_args_.group_k_hats.data(),
+                     IsStructured() ? nullptr : coords_.data(),
+                     IsStructured() ? &grid_ : nullptr};
+}
+
+void AcousticField::Autotune()
+{
+   // Use the cached selection, if any, for the same settings
+   const int settings = int(mixed_precision_) | int(deterministic_) << 1 |
+                        int(unrolling_) << 2 | int(collapsing_) << 3 |
+                        int(use_recurrence_) << 4 | int(use_synthesis_) << 5 |
+                        static_cast<int>(variables_) << 6;
+   const AutotuneCache::Key key = AutotuneCache::MakeKey(Dim(), NumWaves(),
+                                       NumPoints(), IsStructured(), 
+                                       cos_accuracy_, fields_, settings);
+   std::optional<AutotuneCache> cache;
+   if (!autotune_cache_path_.empty())
+   {
+      cache.emplace(autotune_cache_path_);
+      const std::optional<AutotuneCache::Entry> entry = cache->Find(key);
+      if (entry && entry->tile_size > 0 && 
+            EngineRegistry::Contains(entry->engine) &&
+            IsCandidate(EngineRegistry::Capabilities(entry->engine)))
+      {
+         SelectEngine(entry->engine);
+         tile_size_ = entry->tile_size;
+         return;
+      }
+   }
+
+   // Time each candidate engine, over several tile sizes if used
+   std::vector<std::pair<std::string, std::size_t>> candidates;
+   for (const std::string &name : EngineRegistry::Names())
+   {
+      const EngineCapabilities caps = EngineRegistry::Capabilities(name);
+      if (!IsCandidate(caps))
+      {
+         continue;
+      }
+      if (caps.tiled)
+      {
+         for (const std::size_t tile_size : kAutotuneTileSizes)
+         {
+            candidates.emplace_back(name, tile_size);
+         }
+      }
+      else
+      {
+         candidates.emplace_back(name, tile_size_);
+      }
+   }
+
+   // Sample points evenly across the ordering, or the leading rows of the 
+   // grid if structured
+   WaveSeries series = Series();
+   std::vector<double> samples;
+   StructuredGrid sample_grid;
+   if (IsStructured())
+   {
+      sample_grid = grid_;
+      std::size_t budget = kAutotunePoints;
+      for (int d = Dim() - 1; d >= 0; d--)
+      {
+         sample_grid.counts[d] = std::clamp(budget, std::size_t(1), 
+                                             grid_.counts[d]);
+         budget /= sample_grid.counts[d];
+      }
+      series.num_pts = NumGridPoints(Dim(), sample_grid);
+      series.grid = &sample_grid;
+   }
+   else
+   {
+      series.num_pts = std::min(NumPoints(), kAutotunePoints);
+      samples.resize(series.num_pts*Dim());
+      for (std::size_t i = 0; i < series.num_pts; i++)
+      {
+         const std::size_t src = i*NumPoints()/series.num_pts;
+         for (int d = 0; d < Dim(); d++)
+         {
+            samples[d*series.num_pts + i] = coords_[d*NumPoints() + src];
+         }
+      }
+      series.coords = samples.data();
+   }
+   std::vector<double> rho(series.num_pts), rhoV(Dim()*series.num_pts), 
+                        rhoE(series.num_pts);
+
+   // Time each candidate on the sampled points, created from this field 
+   // such that it takes the same automatic paths
+   double best_time = std::numeric_limits<double>::infinity();
+   std::string best_name;
+   std::size_t best_tile_size = tile_size_;
+   for (const auto &[name, tile_size] : candidates)
+   {
+      tile_size_ = tile_size;
+      std::unique_ptr<ComputeEngine> engine = WrapAutomaticPaths(*this, 
+                                    EngineRegistry::Create(name, *this));
+      engine->Finalize(series);
+
+      double time = std::numeric_limits<double>::infinity();
+      for (int r = 0; r <= kAutotuneRepeats; r++)
+      {
+         const auto start = std::chrono::steady_clock::now();
+         engine->Prepare(series, r);
+         engine->Compute(series, r, rho.data(), rhoV.data(), rhoE.data());
+         const std::chrono::duration<double> elapsed = 
+                                 std::chrono::steady_clock::now() - start;
+         time = (r == 0) ? time : std::min(time, elapsed.count());
+      }
+      if (time < best_time)
+      {
+         best_time = time;
+         best_name = name;
+         best_tile_size = tile_size;
+      }
+   }
+   SelectEngine(best_name);
+   tile_size_ = best_tile_size;
+
+   if (cache)
+   {
+      cache->Store(key, {engine_name_, tile_size_});
+   }
+}
+
+void AcousticField::EvaluateKernel(double t)
+{
+   engine_->Compute(Series(), t, rho_.data(), rhoV_.data(), rhoE_.data());
+   if (!engine_->Capabilities().variables)
+   {
+      ConvertVariables(rho_.data(), rhoV_.data(), rhoE_.data());
+   }
+}
+
+void AcousticField::ConvertVariables(double *rho, double *rhoV, 
+                                       double *rhoE) const
+{
+   if (variables_ == Variables::Conservative)
+   {
+      return;
+   }
    [&]<std::size_t... Dims>(const std::index_sequence<Dims...>&)
    {
       ([&]()
        {
          if (Dim() == Dims)
          {
-            if (kernel_ == Kernel::GridPoint)
-            {
-               ComputeKernel<Dims, true>(NumPoints(), rho_bar_, p_bar_, 
-                                    U_bar_.data(), gamma_, NumWaves(), t,
-                                    kernel_args_.rho_coeffs.data(),
-                                    kernel_args_.rhoV_coeffs.data(),
-                                    kernel_args_.rhoE_coeffs.data(), 
-                                    kernel_args_.wave_omegas.data(), 
-                                    kernel_args_.k_dot_x_p_phi.data(), 
-                                    rho_.data(), rhoV_.data(), rhoE_.data());
-            }
-            else if (kernel_ == Kernel::Wave)
-            {
-               ComputeKernel<Dims, false>(NumPoints(), rho_bar_, p_bar_, 
-                                    U_bar_.data(), gamma_, NumWaves(), t,
-                                    kernel_args_.rho_coeffs.data(),
-                                    kernel_args_.rhoV_coeffs.data(),
-                                    kernel_args_.rhoE_coeffs.data(), 
-                                    kernel_args_.wave_omegas.data(), 
-                                    kernel_args_.k_dot_x_p_phi.data(), 
-                                    rho_.data(), rhoV_.data(), rhoE_.data());
-            }
-            else
-            {
-               throw std::logic_error("Unimplemented kernel type!");
-            }
+            ConvertVariablesKernel<Dims>(NumPoints(), rho_bar_, p_bar_, 
+                                       U_bar_.data(), gamma_, variables_,
+                                       rho, rhoV, rhoE);
          }
        }(), ...);
    }(std::index_sequence<1,2,3>{});
@@ -1,8 +1,14 @@
 #ifndef JABBER_ACOUSTIC_FIELD
 #define JABBER_ACOUSTIC_FIELD
 
+#include "kernels.hpp"
+#include "nufft.hpp"
+#include "engine.hpp"
+
 #include <vector>
 #include <span>
+#include <string>
+#include <memory>
 #include <iostream>
 #include <cstdint>
 
@@ -34,6 +40,26 @@ struct Wave
    std::vector<double> k_hat;
 };
 
+/**
+ * @brief Descriptor of a structured (tensor-product) grid, with points
+ * \f$x_d = \text{origin}_d + i_d\,\text{spacing}_d\f$ for
+ * \f$i_d\in[0,\text{counts}_d)\f$.
+ * 
+ * @details Points are ordered with the last axis varying fastest, i.e. 
+ * point \f$(i_0,i_1,i_2)\f$ is at index \f$(i_0 n_1 + i_1)n_2 + i_2\f$.
+ */
+struct StructuredGrid
+{
+   /// Coordinates of the first point, sized by dimension.
+   std::vector<double> origin;
+
+   /// Spacing between points along each axis, sized by dimension.
+   std::vector<double> spacing;
+
+   /// Number of points along each axis, sized by dimension.
+   std::vector<std::size_t> counts;
+};
+
 /**
  * @brief Write span of \ref Wave structs to \p out as a CSV, with columns
  * [Amplitude, Frequency, Phase, Speed, k_hat].
@@ -63,7 +89,10 @@ public:
    /**
     * @brief Kernel type to use in \ref Compute "Compute()".
     * 
-    * @details See file kernels.hpp for more information.
+    * @details Each kernel other than \ref Auto and \ref Custom is 
+    * evaluated by the built-in ComputeEngine of the same name in 
+    * EngineRegistry. See file 
+    * kernels.hpp for more information.
     */
    enum class Kernel : std::uint8_t
    {
@@ -72,11 +101,122 @@ public:
 
       /// Use wave axis in series summation inner-loop.
       Wave,
+
+      /**
+       * @brief Use precomputed spatial phasors, with grid-point axis in
+       * series summation inner-loop.
+       */
+      Phasor,
+
+      /**
+       * @brief Evaluate \f$\vec{k}\cdot\vec{x}+\phi\f$ within the kernel, 
+       * with wave axis in series summation inner-loop. Requires 
+       * O(\ref NumWaves() + \ref NumPoints()) memory.
+       */
+      OnTheFly,
+
+      /**
+       * @brief Same as \ref GridPoint, but explicitly vectorized for the
+       * widest instruction set supported by the running CPU.
+       */
+      SIMD,
+
+      /**
+       * @brief Evaluate via a non-uniform FFT, to within
+       * \ref NUFFTTolerance() of the sum of absolute wave amplitudes. 
+       * Falls back to the direct sum of \ref OnTheFly where that is 
+       * estimated to be cheaper.
+       */
+      NUFFT,
+
+      /**
+       * @brief Same as \ref Phasor, but evaluated as a matrix product of
+       * time and spatial phasors with a blocked, register-tiled 
+       * micro-kernel. Most effective for batches of times in 
+       * \ref ComputeBatch().
+       */
+      GEMM,
+
+      /**
+       * @brief Bin points into spatial tiles, evaluating each wave exactly
+       * once per tile and by a truncated Taylor expansion about the tile
+       * center per point, to within \ref ExpansionTolerance() of the sum 
+       * of absolute wave amplitudes. Requires O(\ref NumWaves() + 
+       * \ref NumPoints()) memory.
+       */
+      TileExpansion,
+
+      /**
+       * @brief Factorize the matrix of spatial phasors (waves x points) 
+       * to within \ref LowRankTolerance() of the sum of absolute wave 
+       * amplitudes by a randomized range finder in \ref Finalize(), and 
+       * evaluate the product of its low-rank factors. Requires O(rank x 
+       * (\ref NumWaves() + \ref NumPoints())) memory, and O(\ref NumWaves()
+       * x \ref NumPoints()) memory transiently in \ref Finalize(). Falls 
+       * back to the direct sum of \ref OnTheFly where the rank exceeds 
+       * half the number of waves or points.
+       */
+      LowRank,
+
+      /**
+       * @brief Sort the waves into octave bands of frequency, and refresh
+       * each band only at an interval within which its cubic Hermite 
+       * interpolation in time is within \ref MultiRateTolerance() of the
+       * sum of absolute wave amplitudes. Bands are interpolated where 
+       * \ref Compute() is called at successive increasing times closer 
+       * than their interval (e.g. via \ref Advance()), and at repeated or
+       * earlier times within an interval already refreshed (e.g. the 
+       * stages of a Runge-Kutta step). Otherwise, they are evaluated 
+       * directly, such that the cost per step is proportional to the 
+       * number of high-frequency waves. Requires O(number of bands x 
+       * \ref NumPoints()) memory.
+       */
+      MultiRate,
+
+      /**
+       * @brief Select the fastest engine in EngineRegistry that is not
+       * approximate in \ref Finalize() (\ref GridPoint over several tile 
+       * sizes, \ref Wave, \ref Phasor, \ref OnTheFly, \ref SIMD, 
+       * \ref GEMM, and any registered), by timing each on a sample of the 
+       * points under the same automatic paths (\ref IsCollapsed(), 
+       * \ref UsesRecurrence()) as the field. The selection is read from 
+       * and stored to \ref AutotuneCachePath() if set. See 
+       * \ref EngineName().
+       */
+      Auto,
+
+      /**
+       * @brief Use an engine registered in EngineRegistry other than the 
+       * built-ins, which must be selected by \ref SetEngine() prior to 
+       * \ref Finalize().
+       */
+      Custom,
       
       /// Number of Kernel enumerators.
       Size,
    };
 
+   /// Default number of \ref Advance() calls between exact evaluations.
+   static constexpr int kDefaultResyncInterval = 1000;
+
+   /// Default relative tolerance of \ref Kernel::NUFFT.
+   static constexpr double kDefaultNUFFTTolerance = 1e-10;
+
+   /**
+    * @brief Default relative tolerance of \ref Kernel::TileExpansion, near
+    * double precision.
+    */
+   static constexpr double kDefaultExpansionTolerance = 1e-15;
+
+   /// Default relative tolerance of \ref Kernel::LowRank.
+   static constexpr double kDefaultLowRankTolerance = 1e-10;
+
+   /// Default relative tolerance of \ref Kernel::MultiRate.
+   static constexpr double kDefaultMultiRateTolerance = 1e-10;
+
+   /// Default memory budget, in bytes, of the snapshots of \ref Period().
+   static constexpr std::size_t kDefaultSnapshotMemory = std::size_t(1) << 30;
+
 private:
 
    /// Spatial dimension.
@@ -100,11 +240,35 @@ private:
    /// Base flow speed of sound
    const double c_bar_;
 
-   /// Kernel type to use.
-   const Kernel kernel_;
+   /**
+    * @brief Kernel type to use, resolved in \ref Finalize() if 
+    * Kernel::Auto. Kernel::Custom if \ref engine_name_ is not built-in.
+    */
+   Kernel kernel_;
+
+   /**
+    * @brief Name of the engine in EngineRegistry, set in \ref Finalize() 
+    * if Kernel::Auto. Empty until \ref SetEngine() if Kernel::Custom.
+    */
+   std::string engine_name_;
+
+   /**
+    * @brief Whether \ref engine_name_ is resolved from Kernel::Auto in each
+    * \ref Finalize().
+    */
+   bool autotune_ = false;
+
+   /// Engine of \ref engine_name_, created in \ref Finalize().
+   std::unique_ptr<ComputeEngine> engine_;
    
-   /// SoA coordinates to compute waves on, [dim][node].
-   std::vector<std::vector<double>> coords_;
+   /**
+    * @brief SoA coordinates to compute waves on, [dim][node]. Empty if
+    * \ref IsStructured().
+    */
+   std::vector<double> coords_;
+
+   /// Structured grid descriptor. Empty if not \ref IsStructured().
+   StructuredGrid grid_;
 
    /// Array of all wave data (AoS).
    std::vector<Wave> waves_;
@@ -147,16 +311,163 @@ private:
       std::vector<double> wave_omegas;
 
       /**
-       * @brief \f$\vec{k}\cdot x+\phi\f$ term computed for all waves at all
-       * points.
+       * @brief Wavenumber vectors, 
+       * \f$\vec{k}_j=\frac{\omega_j}{\vec{\bar{U}}\cdot\hat{k}_j\pm\bar{c}}
+       * \hat{k}_j\f$.
+       * 
+       * @details Size is \ref Dim() x \ref NumWaves(). Ordered as 
+       * [dim][wave].
+       */
+      std::vector<double> wave_ks;
+
+      /**
+       * @brief Acoustic wave phases, \f$\phi\f$.
+       * 
+       * @details Size is \ref NumWaves().
+       */
+      std::vector<double> wave_phases;
+
+      /**
+       * @brief Wavenumber magnitude along each wave direction, 
+       * \f$\frac{\omega_j}{\vec{\bar{U}}\cdot\hat{k}_j\pm\bar{c}}\f$.
+       * 
+       * @details Size is \ref NumWaves().
+       */
+      std::vector<double> wave_k_mags;
+
+      /**
+       * @brief Acoustic wave pressure amplitudes, \f$p'_j\f$.
+       * 
+       * @details Size is \ref NumWaves().
+       */
+      std::vector<double> wave_amps;
+
+      /**
+       * @brief Acoustic wave speeds, 'F' (fast) or 'S' (slow).
+       * 
+       * @details Size is \ref NumWaves().
+       */
+      std::vector<char> wave_speeds;
+
+      /**
+       * @brief Index of the first wave of each group of waves sharing a
+       * direction, with waves ordered contiguously by group.
        * 
-       * @details Size is \ref NumWaves() x \ref NumPoints(). Ordering depends
-       * on \ref kernel_.
+       * @details Size is number of groups + 1.
        */
-      std::vector<double> k_dot_x_p_phi;
+      std::vector<int> group_offsets;
+
+      /**
+       * @brief Direction \f$\hat{k}\f$ of each group of waves.
+       * 
+       * @details Size is number of groups x \ref Dim(), ordered as 
+       * [group][dim].
+       */
+      std::vector<double> group_k_hats;
 
    } kernel_args_;
 
+   /// Time of the most recent \ref Compute() or \ref Advance().
+   double time_ = 0.0;
+
+   /// Timestep of the most recent \ref Advance().
+   double advance_dt_ = 0.0;
+
+   /**
+    * @brief Time at which \ref advance_dt_ was last changed, such that
+    * \ref time_ is tracked as `advance_t0_ + advance_steps_*advance_dt_`
+    * to avoid accumulating round-off error in the time itself.
+    */
+   double advance_t0_ = 0.0;
+
+   /// Number of \ref Advance() calls since \ref advance_t0_.
+   std::size_t advance_steps_ = 0;
+
+   /**
+    * @brief Number of \ref Advance() calls between exact evaluations of the
+    * time phasors.
+    */
+   int resync_interval_ = kDefaultResyncInterval;
+
+   /// Number of \ref Advance() calls since the last exact evaluation.
+   int steps_since_sync_ = 0;
+
+   /// Number of points per tile for \ref Kernel::GridPoint.
+   std::size_t tile_size_ = kDefaultTileSize;
+
+   /**
+    * @brief Whether groups of waves sharing a direction may be evaluated
+    * once per unique projection of the points.
+    */
+   bool collapsing_ = false;
+
+   /**
+    * @brief Whether waves may be evaluated by recurrence over progressions
+    * of uniformly spaced frequencies.
+    */
+   bool use_recurrence_ = false;
+
+   /**
+    * @brief Whether few waves may be evaluated with the wave loop unrolled
+    * by \ref engine_.
+    */
+   bool unrolling_ = true;
+
+   /// Whether \ref Kernel::GridPoint is evaluated in mixed precision.
+   bool mixed_precision_ = false;
+
+   /// Whether \ref Kernel::GridPoint sums in a deterministic order.
+   bool deterministic_ = false;
+
+   /// Conservative variables required by the user.
+   FieldMask fields_ = kAllFields;
+
+   /// Form of the variables output by \ref Compute().
+   Variables variables_ = Variables::Conservative;
+
+   /// Accuracy of cosines in \ref Kernel::GridPoint and \ref Kernel::Wave.
+   Accuracy cos_accuracy_ = Accuracy::Exact;
+
+   /// Relative tolerance of \ref Kernel::NUFFT.
+   double nufft_tolerance_ = kDefaultNUFFTTolerance;
+
+   /// Relative tolerance of \ref Kernel::TileExpansion.
+   double expansion_tolerance_ = kDefaultExpansionTolerance;
+
+   /// Relative tolerance of \ref Kernel::LowRank.
+   double low_rank_tolerance_ = kDefaultLowRankTolerance;
+
+   /// Relative tolerance of \ref Kernel::MultiRate.
+   double multi_rate_tolerance_ = kDefaultMultiRateTolerance;
+
+   /// Number of snapshots per \ref Period(), or zero for none.
+   std::size_t snapshot_count_ = 0;
+
+   /// Memory budget, in bytes, of \ref snapshots_.
+   std::size_t snapshot_memory_ = kDefaultSnapshotMemory;
+
+   /// Degree of the interpolation between \ref snapshots_.
+   int snapshot_order_ = 0;
+
+   /// Common period of all waves, set in \ref Finalize(). Zero if none.
+   double period_ = 0.0;
+
+   /**
+    * @brief Variables computed at each of \ref snapshot_count_ uniformly
+    * spaced times over one \ref Period(), computed in \ref Finalize() if 
+    * \ref UsesSnapshots().
+    * 
+    * @details Size is \ref snapshot_count_ x (\ref Dim() + 2) x 
+    * \ref NumPoints(), ordered as [snapshot][rho, rhoV, rhoE][point].
+    */
+   std::vector<double> snapshots_;
+
+   /// Whether progressions may be evaluated by FFT synthesis.
+   bool use_synthesis_ = false;
+
+   /// Path to the cache of \ref Kernel::Auto, or empty for none.
+   std::string autotune_cache_path_;
+
    /**
     * @brief Fluid density \f$\rho\f$, computed in \ref Compute().
     * 
@@ -179,6 +490,47 @@ private:
     */
    std::vector<double> rhoE_;
 
+   /// Reset the time state to \p t, evaluating time phasors exactly.
+   void ResetTime(double t);
+
+   /// Evaluate the kernel for \ref kernel_ at time \p t.
+   void EvaluateKernel(double t);
+
+   /**
+    * @brief Copy or interpolate \ref snapshots_ to time \p t. Returns 
+    * false without computing if \p t is between snapshots and 
+    * \ref SnapshotOrder() is zero.
+    */
+   bool InterpolateSnapshots(double t);
+
+   /**
+    * @brief Convert conservative variables \p rho, \p rhoV, and \p rhoE of
+    * the points in place to \ref OutputVariables().
+    */
+   void ConvertVariables(double *rho, double *rhoV, double *rhoE) const;
+
+   /**
+    * @brief Check if an engine with \p caps is a candidate of 
+    * \ref Kernel::Auto for this field.
+    */
+   bool IsCandidate(const EngineCapabilities &caps) const;
+
+   /**
+    * @brief Select the engine registered under \p name in EngineRegistry,
+    * setting \ref kernel_ accordingly.
+    */
+   void SelectEngine(std::string name);
+
+   /// Get the series of \ref kernel_args_, as passed to \ref engine_.
+   WaveSeries Series() const;
+
+   /**
+    * @brief Resolve \ref Kernel::Auto to the fastest engine and tile size
+    * for this field, from the cache or by timing each candidate. Called in
+    * \ref Finalize() once \ref Series() is set up.
+    */
+   void Autotune();
+
 public:
    /**
     * @brief Construct a new AcousticField object.
@@ -197,12 +549,45 @@ public:
                   const std::vector<double> U_bar, double gamma,
                   Kernel kernel=Kernel::GridPoint);
 
+   /**
+    * @brief Construct a new AcousticField object on a structured grid.
+    * 
+    * @details On a structured grid, \f$e^{i\vec{k}\cdot\vec{x}}\f$
+    * factorizes into per-axis phasors, so only O(\ref NumWaves() x
+    * \f$\sum_d n_d\f$) spatial phasors are precomputed and stored, rather
+    * than the O(\ref NumWaves() x \ref NumPoints()) of the other kernels.
+    * The field is evaluated via \ref ComputeStructuredKernel(), and
+    * otherwise behaves as \ref Kernel::Phasor (including in 
+    * \ref Advance()).
+    * 
+    * @param dim        Spatial dimension of grid.
+    * @param grid       Structured grid to compute acoustic forcing on, with
+    *                   each member sized \p dim.
+    * @param p_bar      Base flow pressure.
+    * @param rho_bar    Base flow density.
+    * @param U_bar      Base flow velocity vector, of size \p dim.
+    * @param gamma      Base flow specific heat ratio, γ.
+    */
+   AcousticField(int dim, const StructuredGrid &grid,
+                  double p_bar, double rho_bar,
+                  const std::vector<double> U_bar, double gamma);
+
    /// Get the spatial dimension.
    int Dim() const { return dim_; }
 
    /// Get the number of points/coordinates associated with this field.
    std::size_t NumPoints() const { return num_pts_; }
 
+   /// Check if this field was constructed on a \ref StructuredGrid.
+   bool IsStructured() const { return !grid_.counts.empty(); }
+
+   /**
+    * @brief Get the structured grid descriptor.
+    * 
+    * @warning This should only be called if \ref IsStructured().
+    */
+   const StructuredGrid& Grid() const { return grid_; }
+
    /// Get the base flow velocity vector.
    const std::vector<double>& BaseVelocity() const { return U_bar_; }
    
@@ -242,9 +627,10 @@ public:
     * @brief Finalize the acoustic field, to be called after specifying all
     * waves, before \ref Compute().
     * 
-    * @details This function initializes \ref kernel_args_ based on
-    * \ref kernel_ and allocates the flowfield solution \ref rho_, 
-    * \ref rhoV_, and \ref rhoE_ vectors.
+    * @details This function initializes \ref kernel_args_, creates the 
+    * engine of \ref EngineName(), wraps it in the automatic paths (see
+    * WrapAutomaticPaths()) and finalizes it, and allocates the 
+    * flowfield solution \ref rho_, \ref rhoV_, and \ref rhoE_ vectors.
     */
    void Finalize();
 
@@ -252,10 +638,400 @@ public:
     * @brief Compute the perturbed flowfield at time \p t, **after** calling
     * adding all wave data and calling \ref Finalize()
     * 
+    * @details If \ref UsesSnapshots(), the field is instead copied from the
+    * snapshot at \p t modulo \ref Period(), or interpolated between 
+    * snapshots (see \ref SetSnapshotOrder()).
+    * 
     * @warning \ref Finalize() must be called once prior to calls to this,
     * after adding all wave data.
     */
    void Compute(double t);
+
+   /**
+    * @brief Compute the perturbed flowfield at each of \p times, writing
+    * the conservative variables at each time to the output spans.
+    * 
+    * @details Fields evaluated per wave are passed to 
+    * ComputeEngine::ComputeBatch(). For unstructured fields with 
+    * \ref Kernel::Phasor or \ref Kernel::GEMM, all times are then evaluated 
+    * together via \ref ComputeGEMMKernel(), such that the spatial phasors
+    * are read from memory once per batch rather than once per time. 
+    * Otherwise, this is equivalent to calling \ref Compute() for each time.
+    * Afterwards, the field is left as if `Compute(times.back())` was called.
+    * 
+    * @param times      Times to compute the flowfield at.
+    * @param rho        Output density, sized `times.size()` x 
+    *                   \ref NumPoints() with ordering [time][point].
+    * @param rhoV       Output momentum, sized `times.size()` x \ref Dim() x
+    *                   \ref NumPoints() with ordering [time][dim][point].
+    * @param rhoE       Output energy, sized `times.size()` x 
+    *                   \ref NumPoints() with ordering [time][point].
+    * 
+    * @warning \ref Finalize() must be called once prior to calls to this,
+    * after adding all wave data.
+    */
+   void ComputeBatch(std::span<const double> times, std::span<double> rho,
+                     std::span<double> rhoV, std::span<double> rhoE);
+
+   /**
+    * @brief Compute the perturbed flowfield at time \ref Time() + \p dt,
+    * **after** calling \ref Compute() at least once.
+    * 
+    * @details For \ref Kernel::Phasor and structured fields, the per-wave
+    * time phasors \f$e^{-i\omega t}\f$ are advanced by the precomputed 
+    * rotation \f$e^{-i\omega\Delta t}\f$ instead of being re-evaluated, so that no
+    * transcendental functions are evaluated for a constant \p dt. To bound 
+    * the accumulation of round-off error, the time phasors are evaluated
+    * exactly every \ref ResyncInterval() calls. Likewise for any engine 
+    * with EngineCapabilities::advances. For all other kernels, this is 
+    * equivalent to `Compute(Time() + dt)`.
+    * 
+    * @warning \ref Compute() must be called prior to this, to set the initial
+    * time.
+    */
+   void Advance(double dt);
+
+   /// Get the time of the most recently computed flowfield.
+   double Time() const { return time_; }
+
+   /**
+    * @brief Set the number of \ref Advance() calls between exact
+    * evaluations of the time phasors. Must be >= 1, with 1 disabling the
+    * recurrence entirely.
+    */
+   void SetResyncInterval(int interval);
+
+   /// Get the number of \ref Advance() calls between exact evaluations.
+   int ResyncInterval() const { return resync_interval_; }
+
+   /**
+    * @brief Set the number of points per cache-resident tile for
+    * \ref Kernel::GridPoint. Must be >= 1.
+    */
+   void SetTileSize(std::size_t tile_size);
+
+   /// Get the number of points per tile for \ref Kernel::GridPoint.
+   std::size_t TileSize() const { return tile_size_; }
+
+   /**
+    * @brief Set whether \ref Kernel::GridPoint sums the perturbations in 
+    * single precision via \ref ComputeMixedKernel(), which is accurate to
+    * approximately \f$10^{-6}\f$ of the wave amplitudes. Must be called 
+    * prior to \ref Finalize().
+    */
+   void SetMixedPrecision(bool mixed) { mixed_precision_ = mixed; }
+
+   /// Check if \ref Kernel::GridPoint is evaluated in mixed precision.
+   bool MixedPrecision() const { return mixed_precision_; }
+
+   /**
+    * @brief Set whether \ref Kernel::GridPoint sums the waves in an order
+    * independent of the number of threads and of the partition of the 
+    * points (see \ref ComputeKernel()), such that the field is bitwise 
+    * reproducible. All other paths are always reproducible, except 
+    * \ref Kernel::Auto if its selection is not cached. Must be called 
+    * prior to \ref Finalize().
+    */
+   void SetDeterministic(bool deterministic) { deterministic_ = deterministic; }
+
+   /// Check if \ref Kernel::GridPoint sums in a deterministic order.
+   bool IsDeterministic() const { return deterministic_; }
+
+   /**
+    * @brief Set the conservative variables required from \ref Compute(), 
+    * as a nonzero FieldMask. All by default.
+    * 
+    * @details All built-in kernels are specialized to write only these, 
+    * skipping the velocity sums entirely if neither the momentum nor the 
+    * energy is required. Custom engines may still write all variables. 
+    * Must be called prior to \ref Finalize().
+    * 
+    * @warning Variables not in \p fields are not guaranteed to be updated 
+    * by \ref Compute().
+    */
+   void SetOutputFields(FieldMask fields);
+
+   /// Get the conservative variables required from \ref Compute().
+   FieldMask OutputFields() const { return fields_; }
+
+   /**
+    * @brief Set the form of the variables output by \ref Compute(), in 
+    * place of the conservative variables in \ref Density(), 
+    * \ref Momentum(), and \ref Energy() respectively. Conservative by 
+    * default. Must be called prior to \ref Finalize().
+    * 
+    * @details All built-in kernels write them directly, such that 
+    * perturbations are evaluated without any base flow or nonlinear 
+    * terms and may be added to a solver's residual. Custom engines that 
+    * do not set EngineCapabilities::variables compute the conservative 
+    * variables, which are converted via \ref ConvertVariablesKernel().
+    */
+   void SetOutputVariables(Variables variables) { variables_ = variables; }
+
+   /// Get the form of the variables output by \ref Compute().
+   Variables OutputVariables() const { return variables_; }
+
+   /**
+    * @brief Set whether few waves may be evaluated with the wave loop
+    * unrolled, as described in \ref IsUnrolled(). Enabled by default. Must 
+    * be called prior to \ref Finalize().
+    */
+   void SetUnrolling(bool unrolling) { unrolling_ = unrolling; }
+
+   /// Check if few waves may be evaluated with the wave loop unrolled.
+   bool Unrolling() const { return unrolling_; }
+
+   /**
+    * @brief Set whether groups of waves sharing a direction may be 
+    * evaluated on the unique projections of the points, as described in 
+    * \ref IsCollapsed(). Disabled by default, such that the selected 
+    * \ref kernel_ is used. Must be called prior to \ref Finalize().
+    */
+   void SetCollapsing(bool collapsing) { collapsing_ = collapsing; }
+
+   /// Check if groups of waves sharing a direction may be collapsed.
+   bool Collapsing() const { return collapsing_; }
+
+   /**
+    * @brief Set whether progressions of uniformly spaced frequencies may be
+    * evaluated by recurrence, as described in \ref UsesRecurrence(). 
+    * Disabled by default, such that the selected \ref kernel_ is used. 
+    * Must be called prior to \ref Finalize().
+    */
+   void SetRecurrence(bool recurrence) { use_recurrence_ = recurrence; }
+
+   /// Check if progressions may be evaluated by recurrence.
+   bool Recurrence() const { return use_recurrence_; }
+
+   /**
+    * @brief Set whether progressions may be evaluated by FFT synthesis, as
+    * described in \ref UsesFFTSynthesis(). Disabled by default, such that
+    * the selected \ref kernel_ is used. Must be called prior to 
+    * \ref Finalize().
+    */
+   void SetFFTSynthesis(bool synthesis) { use_synthesis_ = synthesis; }
+
+   /// Check if progressions may be evaluated by FFT synthesis.
+   bool FFTSynthesis() const { return use_synthesis_; }
+
+   /**
+    * @brief Set the accuracy of the cosine evaluation in 
+    * \ref Kernel::GridPoint and \ref Kernel::Wave, and in collapsed 
+    * fields (\ref IsCollapsed()). See \ref Accuracy.
+    */
+   void SetCosineAccuracy(Accuracy accuracy) { cos_accuracy_ = accuracy; }
+
+   /**
+    * @brief Get the accuracy of the cosine evaluation in 
+    * \ref Kernel::GridPoint and \ref Kernel::Wave, and in collapsed 
+    * fields.
+    */
+   Accuracy CosineAccuracy() const { return cos_accuracy_; }
+
+   /**
+    * @brief Check if the field is evaluated by direction group on the 
+    * unique projections \f$\hat{k}\cdot\vec{x}\f$ of the points via
+    * \ref ComputeCollapsedKernel(), in place of \ref kernel_.
+    * 
+    * @details This is determined in \ref Finalize(), for unstructured 
+    * fields with few distinct wave directions (e.g. a PSD source with a 
+    * single direction) where the points share few projections onto them, 
+    * such as for grids aligned with the wave directions, if enabled by 
+    * \ref SetCollapsing() and not in mixed precision. Collapsed fields are
+    * evaluated with the cosine accuracy, output fields, and output 
+    * variables of the field, and are deterministic.
+    */
+   bool IsCollapsed() const 
+   { 
+      return engine_ && engine_->Path() == EnginePath::Collapsed; 
+   }
+
+   /**
+    * @brief Check if the field is evaluated by recurrence over the wave
+    * index via \ref ComputeRecurrenceKernel(), in place of \ref kernel_.
+    * 
+    * @details This is determined in \ref Finalize(), for unstructured and
+    * non-collapsed fields where the waves of each direction and speed have
+    * uniformly spaced frequencies (e.g. uniformly discretized PSD sources),
+    * with at least 16 waves in each such progression, if enabled by 
+    * \ref SetRecurrence(). As the recurrence is evaluated exactly in 
+    * double precision, it is not used with a lower 
+    * \ref CosineAccuracy() or in mixed precision.
+    */
+   bool UsesRecurrence() const 
+   { 
+      return engine_ && engine_->Path() == EnginePath::Recurrence;
+   }
+
+   /**
+    * @brief Check if the engine evaluates the field with the wave loop
+    * unrolled via \ref ComputeUnrolledKernel().
+    * 
+    * @details This is determined in \ref Finalize(), for unstructured 
+    * fields evaluated per wave by \ref Kernel::GridPoint (not in mixed 
+    * precision) or \ref Kernel::Wave with at most \ref kMaxUnrolledWaves
+    * waves (e.g. a few SingleWave sources), with the same cosine accuracy,
+    * outputs, and variables. The engine name is unchanged. See also 
+    * \ref SetUnrolling() and EnginePath::Unrolled.
+    */
+   bool IsUnrolled() const 
+   { 
+      return engine_ && engine_->Path() == EnginePath::Unrolled;
+   }
+
+   /**
+    * @brief Check if the field is evaluated by FFT synthesis over 
+    * progressions of uniformly spaced frequencies via 
+    * \ref ComputeSynthesisKernel(), in place of \ref kernel_.
+    * 
+    * @details This is determined in \ref Finalize(), for fields whose 
+    * waves form progressions as described in \ref UsesRecurrence(), where
+    * estimated to be cheaper than recurrence for every progression, if 
+    * enabled by \ref SetFFTSynthesis() (independently of 
+    * \ref SetRecurrence()). It is then accurate to within 
+    * \ref NUFFTTolerance() of the sum of absolute wave amplitudes, and 
+    * writes the output fields and variables of the field.
+    */
+   bool UsesFFTSynthesis() const 
+   { 
+      return engine_ && engine_->Path() == EnginePath::Synthesis; 
+   }
+
+   /**
+    * @brief Set the relative tolerance of \ref Kernel::NUFFT and of the 
+    * FFT synthesis (see \ref UsesFFTSynthesis()), in (0,1). Must be called
+    * prior to \ref Finalize().
+    */
+   void SetNUFFTTolerance(double tol);
+
+   /// Get the relative tolerance of \ref Kernel::NUFFT and FFT synthesis.
+   double NUFFTTolerance() const { return nufft_tolerance_; }
+
+   /**
+    * @brief Set the relative tolerance of \ref Kernel::TileExpansion, in 
+    * (0,1). Must be called prior to \ref Finalize().
+    */
+   void SetExpansionTolerance(double tol);
+
+   /// Get the relative tolerance of \ref Kernel::TileExpansion.
+   double ExpansionTolerance() const { return expansion_tolerance_; }
+
+   /**
+    * @brief Set the relative tolerance of \ref Kernel::LowRank, in (0,1).
+    * Must be called prior to \ref Finalize().
+    */
+   void SetLowRankTolerance(double tol);
+
+   /// Get the relative tolerance of \ref Kernel::LowRank.
+   double LowRankTolerance() const { return low_rank_tolerance_; }
+
+   /**
+    * @brief Set the relative tolerance of \ref Kernel::MultiRate, in 
+    * (0,1). Must be called prior to \ref Finalize().
+    */
+   void SetMultiRateTolerance(double tol);
+
+   /// Get the relative tolerance of \ref Kernel::MultiRate.
+   double MultiRateTolerance() const { return multi_rate_tolerance_; }
+
+   /**
+    * @brief Set the number of snapshots of the field precomputed over one
+    * \ref Period() in \ref Finalize(), uniformly spaced in time. Zero 
+    * (default) for none. Must be called prior to \ref Finalize().
+    * 
+    * @details Snapshots are only precomputed if the field is periodic and 
+    * they fit within \ref SnapshotMemory(), see \ref UsesSnapshots(). 
+    * For the field to be resolved between snapshots, the count should 
+    * exceed several times the ratio of the highest frequency to the 
+    * fundamental \f$1/T\f$.
+    */
+   void SetSnapshotCount(std::size_t count) { snapshot_count_ = count; }
+
+   /// Get the number of snapshots precomputed over one \ref Period().
+   std::size_t SnapshotCount() const { return snapshot_count_; }
+
+   /**
+    * @brief Set the memory budget, in bytes, of the snapshots of 
+    * \ref SetSnapshotCount(). Must be called prior to \ref Finalize().
+    */
+   void SetSnapshotMemory(std::size_t bytes) { snapshot_memory_ = bytes; }
+
+   /// Get the memory budget, in bytes, of the snapshots.
+   std::size_t SnapshotMemory() const { return snapshot_memory_; }
+
+   /**
+    * @brief Set the degree of the periodic Lagrange interpolation of the 
+    * snapshots to times between them, over the `order + 1` nearest. Must 
+    * be >= 0, with zero (default) evaluating such times exactly instead.
+    * Must be less than \ref SnapshotCount() for snapshots to be used.
+    */
+   void SetSnapshotOrder(int order);
+
+   /// Get the degree of the interpolation between snapshots.
+   int SnapshotOrder() const { return snapshot_order_; }
+
+   /**
+    * @brief Get the common period \f$T\f$ of the field in time, or zero if
+    * not periodic. Determined in \ref Finalize().
+    * 
+    * @details The field is periodic if every nonzero wave frequency is an
+    * integer multiple of a fundamental frequency \f$1/T\f$, to within a 
+    * relative tolerance of \f$10^{-10}\f$ and with at most \f$10^6\f$
+    * harmonics.
+    */
+   double Period() const { return period_; }
+
+   /**
+    * @brief Check if \ref Compute() reads from snapshots precomputed over 
+    * one \ref Period(), rather than evaluating the field.
+    * 
+    * @details This is determined in \ref Finalize(), for periodic fields 
+    * where \ref SnapshotCount() exceeds \ref SnapshotOrder() and the 
+    * snapshots fit within \ref SnapshotMemory(). \ref ComputeBatch() and
+    * \ref Advance() then call \ref Compute() for each time.
+    */
+   bool UsesSnapshots() const { return !snapshots_.empty(); }
+
+   /**
+    * @brief Set the path to the file caching the selections of 
+    * \ref Kernel::Auto, keyed by the CPU model, dimension, number of waves,
+    * order of magnitude of the number of points, whether structured, 
+    * \ref CosineAccuracy(), \ref OutputFields(), the other settings read 
+    * by the engines (e.g. \ref MixedPrecision() and the automatic paths), 
+    * and number of threads. Empty (default) for no cache. Must be called 
+    * prior to \ref Finalize().
+    */
+   void SetAutotuneCachePath(std::string path) { autotune_cache_path_ = path; }
+
+   /// Get the path to the cache of \ref Kernel::Auto.
+   const std::string& AutotuneCachePath() const { return autotune_cache_path_; }
+
+   /**
+    * @brief Get the kernel used, which is resolved from \ref Kernel::Auto
+    * in \ref Finalize(). Kernel::Custom if the engine is not built-in.
+    */
+   Kernel SelectedKernel() const { return kernel_; }
+
+   /**
+    * @brief Select the engine registered under \p name in EngineRegistry,
+    * in place of the kernel given in construction. Must be called prior to
+    * \ref Finalize().
+    */
+   void SetEngine(std::string name);
+
+   /**
+    * @brief Get the name of the engine used, which is resolved from 
+    * \ref Kernel::Auto in \ref Finalize().
+    */
+   const std::string& EngineName() const { return engine_name_; }
+
+   /**
+    * @brief Get the estimated number of bytes allocated by the engine in
+    * \ref Finalize(), for whichever path the field is evaluated by.
+    * 
+    * @warning This should only be called after \ref Finalize().
+    */
+   std::size_t EngineMemory() const;
    
    /**
     * @brief Get span of computed flow densities.
@@ -0,0 +1,130 @@
+#include "autotune.hpp"
+
+#include <bit>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <stdexcept>
+#include <filesystem>
+
+#ifdef JABBER_WITH_OPENMP
+#include <omp.h>
+#endif // JABBER_WITH_OPENMP
+
+namespace jabber
+{
+
+namespace
+{
+
+/**
+ * @brief Get the CPU model name from `/proc/cpuinfo`, or "unknown" where
+ * that is unavailable.
+ */
+std::string CPUModel()
+{
+   std::ifstream cpuinfo("/proc/cpuinfo");
+   for (std::string line; std::getline(cpuinfo, line);)
+   {
+      if (line.starts_with("model name"))
+      {
+         const std::size_t colon = line.find(':');
+         const std::size_t begin = line.find_first_not_of(" \t", colon + 1);
+         if (colon != std::string::npos && begin != std::string::npos)
+         {
+            // Tabs separate the fields of each cache entry
+            std::string model = line.substr(begin);
+            std::replace(model.begin(), model.end(), '\t', ' ');
+            return model;
+         }
+      }
+   }
+   return "unknown";
+}
+
+} // namespace
+
+AutotuneCache::AutotuneCache(std::string path)
+: path_(std::move(path))
+{
+   std::ifstream in(path_);
+   for (std::string line; std::getline(in, line);)
+   {
+      std::istringstream fields(line);
+      Key key;
+      Entry entry;
+      if (std::getline(fields, key.cpu, '\t') && 
+            fields >> key.dim >> key.num_waves >> key.pts_bucket 
+                     >> key.structured >> key.accuracy >> key.fields
+                     >> key.settings >> key.num_threads >> entry.engine 
+                     >> entry.tile_size)
+      {
+         entries_.emplace_back(key, entry);
+      }
+   }
+}
+
+AutotuneCache::Key AutotuneCache::MakeKey(int dim, int num_waves, 
+                                          std::size_t num_pts, 
+                                          bool structured, Accuracy accuracy,
+                                          FieldMask fields, int settings)
+{
+#ifdef JABBER_WITH_OPENMP
+   const int num_threads = omp_get_max_threads();
+#else
+   const int num_threads = 1;
+#endif // JABBER_WITH_OPENMP
+
+   return Key{CPUModel(), dim, num_waves, 
+               static_cast<int>(std::bit_width(num_pts)), structured,
+               static_cast<int>(accuracy), static_cast<int>(fields), 
+               settings, num_threads};
+}
+
+std::optional<AutotuneCache::Entry> AutotuneCache::Find(const Key &key) const
+{
+   const auto it = std::find_if(entries_.begin(), entries_.end(), 
+                                 [&](const auto &e) { return e.first == key; });
+   if (it == entries_.end())
+   {
+      return std::nullopt;
+   }
+   return it->second;
+}
+
+void AutotuneCache::Store(const Key &key, const Entry &entry)
+{
+   const auto it = std::find_if(entries_.begin(), entries_.end(), 
+                                 [&](const auto &e) { return e.first == key; });
+   if (it == entries_.end())
+   {
+      entries_.emplace_back(key, entry);
+   }
+   else
+   {
+      it->second = entry;
+   }
+
+   // Write to a temporary file first, so that concurrent readers never see
+   // a partially written cache
+   const std::string tmp_path = path_ + ".tmp";
+   {
+      std::ofstream out(tmp_path);
+      for (const auto &[k, e] : entries_)
+      {
+         out << k.cpu << '\t' << k.dim << '\t' << k.num_waves << '\t' 
+               << k.pts_bucket << '\t' << k.structured << '\t' 
+               << k.accuracy << '\t' << k.fields << '\t' 
+               << k.settings << '\t' << k.num_threads << '\t' 
+               << e.engine << '\t' << e.tile_size << '\n';
+      }
+      if (!out)
+      {
+         throw std::runtime_error("Unable to write autotune cache " + 
+                                    tmp_path);
+      }
+   }
+   std::filesystem::rename(tmp_path, path_);
+}
+
+} // namespace jabber
@@ -0,0 +1,116 @@
+#ifndef JABBER_AUTOTUNE
+#define JABBER_AUTOTUNE
+
+#include "kernels.hpp"
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <optional>
+#include <cstddef>
+
+namespace jabber
+{
+
+/**
+ * @brief On-disk cache of autotuning results, keyed by the machine and the
+ * problem size, such that later runs need not repeat the tuning.
+ * 
+ * @details The cache is a text file with one entry per line, each with the
+ * tab-separated fields of \ref Key followed by those of \ref Entry. Lines
+ * that cannot be parsed are ignored. The file is rewritten in full by 
+ * \ref Store(), via a temporary file that is then renamed over it.
+ */
+class AutotuneCache
+{
+public:
+
+   /// Machine and problem size that a result was tuned for.
+   struct Key
+   {
+      /// CPU model name.
+      std::string cpu;
+
+      /// Spatial dimension.
+      int dim;
+
+      /// Number of waves.
+      int num_waves;
+
+      /// Bit width of the number of points, \f$\lfloor\log_2N\rfloor+1\f$.
+      int pts_bucket;
+
+      /// Whether the points are of a structured grid.
+      bool structured;
+
+      /// Accuracy of the cosine evaluation, as an integer.
+      int accuracy;
+
+      /// Conservative variables required, as an integer FieldMask.
+      int fields;
+
+      /**
+       * @brief Settings of the field read by the engines, which may select 
+       * their paths, as a bitmask (see \ref MakeKey()).
+       */
+      int settings;
+
+      /// Maximum number of threads.
+      int num_threads;
+
+      bool operator==(const Key &other) const = default;
+   };
+
+   /// Tuned result.
+   struct Entry
+   {
+      /// Name of the engine in EngineRegistry.
+      std::string engine;
+
+      /// Number of points per tile.
+      std::size_t tile_size;
+   };
+
+private:
+
+   /// Path to the cache file.
+   std::string path_;
+
+   /// All entries read from or stored to \ref path_.
+   std::vector<std::pair<Key, Entry>> entries_;
+
+public:
+
+   /**
+    * @brief Construct a new AutotuneCache object, reading all entries of 
+    * the file at \p path if it exists.
+    */
+   explicit AutotuneCache(std::string path);
+
+   /**
+    * @brief Get the key of a problem with \p num_waves waves and 
+    * \p num_pts points in dimension \p dim, either \p structured or not, 
+    * evaluated at cosine \p accuracy for the variables in \p fields, on
+    * the running machine.
+    * 
+    * @details \p settings holds any further settings of the field that the
+    * engines read, such as whether mixed precision or each automatic path
+    * is enabled, with one bit per setting as chosen by the caller.
+    */
+   static Key MakeKey(int dim, int num_waves, std::size_t num_pts, 
+                        bool structured, Accuracy accuracy, FieldMask fields,
+                        int settings);
+
+   /// Get the entry of \p key, if any.
+   std::optional<Entry> Find(const Key &key) const;
+
+   /**
+    * @brief Insert or replace the entry of \p key, and write all entries to
+    * the cache file.
+    */
+   void Store(const Key &key, const Entry &entry);
+};
+
+} // namespace jabber
+
+#endif // JABBER_AUTOTUNE
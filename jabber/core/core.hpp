@@ -2,4 +2,7 @@
 #include "acoustic_field.hpp"
 #include "transfer_functions.hpp"
 #include "kernels.hpp"
+#include "nufft.hpp"
+#include "engine.hpp"
+#include "autotune.hpp"
 #include "psd.hpp"
@@ -0,0 +1,2351 @@
+#include "engine.hpp"
+#include "acoustic_field.hpp"
+#include "nufft.hpp"
+
+#include <math.h>
+#include <numeric>
+#include <algorithm>
+#include <limits>
+#include <format>
+#include <ranges>
+#include <utility>
+#include <complex>
+#include <stdexcept>
+#include <cctype>
+#include <cstdint>
+#include <random>
+#include <optional>
+#include <span>
+#include <tuple>
+#include <unordered_map>
+
+namespace jabber
+{
+
+namespace
+{
+
+/**
+ * @brief Call \p func with a `std::integral_constant` of the spatial
+ * dimension \p dim, for dimensions 1-3.
+ */
+template<typename TFunc>
+void DispatchDim(const int dim, TFunc &&func)
+{
+   [&]<std::size_t... Dims>(const std::index_sequence<Dims...>&)
+   {
+      ([&]()
+       {
+         if (dim == Dims)
+         {
+            func(std::integral_constant<std::size_t, Dims>{});
+         }
+       }(), ...);
+   }(std::index_sequence<1,2,3>{});
+}
+
+/**
+ * @brief Call `func(w, i, k_dot_x_p_phi)` with \f$\vec{k}\cdot x+\phi\f$ of
+ * each wave `w` at each point `i` of \p series, projecting each point onto
+ * the direction of each group only once.
+ */
+template<typename TFunc>
+void ForEachPhase(const WaveSeries &series, TFunc &&func)
+{
+   std::vector<double> proj(series.num_pts);
+   for (int g = 0; g < series.num_groups; g++)
+   {
+      const double *k_hat = series.group_k_hats + g*series.dim;
+      for (std::size_t i = 0; i < series.num_pts; i++)
+      {
+         double s = 0.0;
+         for (int d = 0; d < series.dim; d++)
+         {
+            s += k_hat[d]*series.coords[d*series.num_pts + i];
+         }
+         proj[i] = s;
+      }
+      for (int w = series.group_offsets[g]; w < series.group_offsets[g+1];
+            w++)
+      {
+         const double k = series.wave_k_mags[w];
+         const double phi = series.wave_phases[w];
+         for (std::size_t i = 0; i < series.num_pts; i++)
+         {
+            func(w, i, k*proj[i] + phi);
+         }
+      }
+   }
+}
+
+/**
+ * @brief Project each of \p num_pts SoA coordinates in \p coords onto
+ * direction \p k_hat, storing \f$\hat{k}\cdot\vec{x}\f$ in \p proj.
+ */
+void Project(int dim, std::size_t num_pts, const double *coords, 
+               const double *k_hat, double *proj)
+{
+   for (std::size_t i = 0; i < num_pts; i++)
+   {
+      double s = 0.0;
+      for (int d = 0; d < dim; d++)
+      {
+         s += k_hat[d]*coords[d*num_pts + i];
+      }
+      proj[i] = s;
+   }
+}
+
+/// Minimum number of waves per progression in \ref ProgressionEngine.
+constexpr int kMinProgressionLength = 16;
+
+/**
+ * @brief Check if \p omegas, sorted in increasing order, are uniformly 
+ * spaced to within rounding, with at least \ref kMinProgressionLength 
+ * frequencies.
+ */
+bool IsProgression(std::span<const double> omegas)
+{
+   const int n = omegas.size();
+   if (n < kMinProgressionLength || !(omegas.back() > omegas.front()))
+   {
+      return false;
+   }
+   const double d_omega = (omegas.back() - omegas.front())/(n-1);
+   const double tol = 16*std::numeric_limits<double>::epsilon()*
+                        omegas.back();
+   for (int j = 0; j < n; j++)
+   {
+      if (std::abs(omegas[j] - (omegas.front() + j*d_omega)) > tol)
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+/**
+ * @brief Engine of AcousticField::Kernel::GridPoint (\p TGridInnerLoop
+ * true) or AcousticField::Kernel::Wave, via \ref ComputeKernel() or
+ * \ref ComputeMixedKernel(), or via \ref ComputeUnrolledKernel() for few
+ * waves (see AcousticField::IsUnrolled()).
+ */
+template<bool TGridInnerLoop>
+class PhaseEngine : public ComputeEngine
+{
+private:
+
+   /// Number of points per tile.
+   const std::size_t tile_size_;
+
+   /// Whether evaluated in mixed precision, if \p TGridInnerLoop.
+   const bool mixed_precision_;
+
+   /// Accuracy of the cosines.
+   const Accuracy accuracy_;
+
+   /// Whether summed in a deterministic order, if \p TGridInnerLoop.
+   const bool deterministic_;
+
+   /// Conservative variables to write.
+   const FieldMask fields_;
+
+   /// Form of the variables to write.
+   const Variables variables_;
+
+   /// Whether few waves may be evaluated with the wave loop unrolled.
+   const bool unrolling_;
+
+   /// Whether the wave loop is unrolled, in place of \ref k_dot_x_p_phi_.
+   bool unrolled_ = false;
+
+   /**
+    * @brief \f$\vec{k}\cdot x+\phi\f$ of all waves at all points, ordered
+    * as [wave][point] if \p TGridInnerLoop and [point][wave] otherwise.
+    * Unused if \ref mixed_precision_.
+    */
+   std::vector<double> k_dot_x_p_phi_;
+
+   /**
+    * @brief \f$\vec{k}\cdot x+\phi\f$ reduced to \f$[-\pi,\pi]\f$ and
+    * rounded to single precision, ordered as [wave][point]. Only used if
+    * \ref mixed_precision_.
+    */
+   std::vector<float> k_dot_x_p_phi_mixed_;
+
+   /**
+    * @brief Check if the wave loop of \p series is unrolled, which is only
+    * the case for few waves evaluated in double precision.
+    */
+   bool Unrolls(const WaveSeries &series) const
+   {
+      return unrolling_ && !mixed_precision_ && series.coords && 
+               series.num_waves > 0 && series.num_waves <= kMaxUnrolledWaves;
+   }
+
+public:
+
+   explicit PhaseEngine(const AcousticField &field)
+   : tile_size_(field.TileSize()),
+     mixed_precision_(TGridInnerLoop && field.MixedPrecision()),
+     accuracy_(field.CosineAccuracy()),
+     deterministic_(field.IsDeterministic()),
+     fields_(field.OutputFields()),
+     variables_(field.OutputVariables()),
+     unrolling_(field.Unrolling())
+   { }
+
+   /// Capabilities of every instance, as registered in EngineRegistry.
+   static EngineCapabilities StaticCapabilities()
+   {
+      EngineCapabilities caps;
+      caps.variables = true;
+      caps.tiled = TGridInnerLoop;
+      caps.autotuned = true;
+      return caps;
+   }
+
+   EngineCapabilities Capabilities() const override
+   {
+      return StaticCapabilities();
+   }
+
+   EnginePath Path() const override
+   {
+      return unrolled_ ? EnginePath::Unrolled : EnginePath::PerWave;
+   }
+
+   std::size_t MemoryEstimate(const WaveSeries &series) const override
+   {
+      if (Unrolls(series))
+      {
+         return 0;
+      }
+      return std::size_t(series.num_waves)*series.num_pts*
+               (mixed_precision_ ? sizeof(float) : sizeof(double));
+   }
+
+   void Finalize(const WaveSeries &series) override
+   {
+      const std::size_t num_pts = series.num_pts;
+      const std::size_t num_waves = series.num_waves;
+
+      // Unrolled waves are evaluated directly from the coordinates
+      unrolled_ = Unrolls(series);
+      if (unrolled_)
+      {
+         k_dot_x_p_phi_.clear();
+         k_dot_x_p_phi_mixed_.clear();
+         return;
+      }
+      if (mixed_precision_)
+      {
+         k_dot_x_p_phi_mixed_.resize(num_waves*num_pts);
+         ForEachPhase(series, [&](const std::size_t w, const std::size_t i,
+                                    const double k_dot_x_p_phi)
+         {
+            // Reduce prior to rounding, to retain precision
+            k_dot_x_p_phi_mixed_[w*num_pts + i] =
+               static_cast<float>(std::remainder(k_dot_x_p_phi, 2.0*M_PI));
+         });
+         return;
+      }
+
+      k_dot_x_p_phi_.resize(num_waves*num_pts);
+      ForEachPhase(series, [&](const std::size_t w, const std::size_t i,
+                                 const double k_dot_x_p_phi)
+      {
+         if constexpr (TGridInnerLoop)
+         {
+            k_dot_x_p_phi_[w*num_pts + i] = k_dot_x_p_phi;
+         }
+         else
+         {
+            k_dot_x_p_phi_[i*num_waves + w] = k_dot_x_p_phi;
+         }
+      });
+   }
+
+   void Compute(const WaveSeries &series, const double t, double *rho,
+                  double *rhoV, double *rhoE) override
+   {
+      DispatchDim(series.dim, [&](const auto dim)
+      {
+         constexpr std::size_t TDim = decltype(dim)::value;
+         if (unrolled_)
+         {
+            ComputeUnrolledKernel<TDim>(series.num_pts, series.rho_bar, 
+                              series.p_bar, series.U_bar, series.gamma,
+                              series.num_waves, t, series.rho_coeffs,
+                              series.rhoV_coeffs, series.wave_omegas,
+                              series.wave_ks, series.wave_phases, 
+                              series.coords, rho, rhoV, rhoE, accuracy_,
+                              fields_, variables_);
+         }
+         else if (mixed_precision_)
+         {
+            ComputeMixedKernel<TDim>(series.num_pts, series.rho_bar,
+                              series.p_bar, series.U_bar, series.gamma,
+                              series.num_waves, t, series.rho_coeffs,
+                              series.rhoV_coeffs, series.wave_omegas,
+                              k_dot_x_p_phi_mixed_.data(), rho, rhoV, rhoE,
+                              tile_size_, fields_, variables_);
+         }
+         else
+         {
+            ComputeKernel<TDim, TGridInnerLoop>(series.num_pts,
+                              series.rho_bar, series.p_bar, series.U_bar,
+                              series.gamma, series.num_waves, t,
+                              series.rho_coeffs, series.rhoV_coeffs,
+                              series.wave_omegas, k_dot_x_p_phi_.data(),
+                              rho, rhoV, rhoE, tile_size_, accuracy_,
+                              deterministic_, fields_, variables_);
+         }
+      });
+   }
+};
+
+/// Engine of AcousticField::Kernel::SIMD, via \ref ComputeSIMDKernel().
+class SIMDEngine : public ComputeEngine
+{
+private:
+
+   /// Conservative variables to write.
+   const FieldMask fields_;
+
+   /// Form of the variables to write.
+   const Variables variables_;
+
+   /// \f$\vec{k}\cdot x+\phi\f$ of all waves at all points, [wave][point].
+   std::vector<double> k_dot_x_p_phi_;
+
+public:
+
+   explicit SIMDEngine(const AcousticField &field)
+   : fields_(field.OutputFields()),
+     variables_(field.OutputVariables())
+   { }
+
+   /// Capabilities of every instance, as registered in EngineRegistry.
+   static EngineCapabilities StaticCapabilities()
+   {
+      EngineCapabilities caps;
+      caps.variables = true;
+      caps.autotuned = true;
+      return caps;
+   }
+
+   EngineCapabilities Capabilities() const override
+   {
+      return StaticCapabilities();
+   }
+
+   std::size_t MemoryEstimate(const WaveSeries &series) const override
+   {
+      return std::size_t(series.num_waves)*series.num_pts*sizeof(double);
+   }
+
+   void Finalize(const WaveSeries &series) override
+   {
+      const std::size_t num_pts = series.num_pts;
+      k_dot_x_p_phi_.resize(series.num_waves*num_pts);
+      ForEachPhase(series, [&](const std::size_t w, const std::size_t i,
+                                 const double k_dot_x_p_phi)
+      {
+         k_dot_x_p_phi_[w*num_pts + i] = k_dot_x_p_phi;
+      });
+   }
+
+   void Compute(const WaveSeries &series, const double t, double *rho,
+                  double *rhoV, double *rhoE) override
+   {
+      DispatchDim(series.dim, [&](const auto dim)
+      {
+         ComputeSIMDKernel<decltype(dim)::value>(series.num_pts,
+                              series.rho_bar, series.p_bar, series.U_bar,
+                              series.gamma, series.num_waves, t,
+                              series.rho_coeffs, series.rhoV_coeffs,
+                              series.wave_omegas, k_dot_x_p_phi_.data(),
+                              rho, rhoV, rhoE, fields_, variables_);
+      });
+   }
+};
+
+/**
+ * @brief Engine of AcousticField::Kernel::GEMM, via
+ * \ref ComputeGEMMKernel().
+ */
+class GEMMEngine : public ComputeEngine
+{
+protected:
+
+   /// Conservative variables to write.
+   const FieldMask fields_;
+
+   /// Form of the variables to write.
+   const Variables variables_;
+
+   /**
+    * @brief \f$\cos(\vec{k}\cdot x+\phi)\f$ of all waves at all points,
+    * [wave][point].
+    */
+   std::vector<double> cos_k_dot_x_p_phi_;
+
+   /**
+    * @brief \f$\sin(\vec{k}\cdot x+\phi)\f$ of all waves at all points,
+    * [wave][point].
+    */
+   std::vector<double> sin_k_dot_x_p_phi_;
+
+public:
+
+   explicit GEMMEngine(const AcousticField &field)
+   : fields_(field.OutputFields()),
+     variables_(field.OutputVariables())
+   { }
+
+   /// Capabilities of every instance, as registered in EngineRegistry.
+   static EngineCapabilities StaticCapabilities()
+   {
+      EngineCapabilities caps;
+      caps.variables = true;
+      caps.autotuned = true;
+      return caps;
+   }
+
+   EngineCapabilities Capabilities() const override
+   {
+      return StaticCapabilities();
+   }
+
+   std::size_t MemoryEstimate(const WaveSeries &series) const override
+   {
+      return 2*std::size_t(series.num_waves)*series.num_pts*sizeof(double);
+   }
+
+   void Finalize(const WaveSeries &series) override
+   {
+      const std::size_t num_pts = series.num_pts;
+      cos_k_dot_x_p_phi_.resize(series.num_waves*num_pts);
+      sin_k_dot_x_p_phi_.resize(series.num_waves*num_pts);
+      ForEachPhase(series, [&](const std::size_t w, const std::size_t i,
+                                 const double k_dot_x_p_phi)
+      {
+         cos_k_dot_x_p_phi_[w*num_pts + i] = std::cos(k_dot_x_p_phi);
+         sin_k_dot_x_p_phi_[w*num_pts + i] = std::sin(k_dot_x_p_phi);
+      });
+   }
+
+   void Compute(const WaveSeries &series, double t, double *rho,
+                  double *rhoV, double *rhoE) override
+   {
+      ComputeBatch(series, 1, &t, rho, rhoV, rhoE);
+   }
+
+   void ComputeBatch(const WaveSeries &series, const std::size_t num_times,
+                     const double *times, double *rho, double *rhoV,
+                     double *rhoE) override
+   {
+      DispatchDim(series.dim, [&](const auto dim)
+      {
+         ComputeGEMMKernel<decltype(dim)::value>(series.num_pts,
+                              series.rho_bar, series.p_bar, series.U_bar,
+                              series.gamma, series.num_waves, num_times,
+                              times, series.rho_coeffs, series.rhoV_coeffs,
+                              series.wave_omegas, cos_k_dot_x_p_phi_.data(),
+                              sin_k_dot_x_p_phi_.data(), rho, rhoV, rhoE,
+                              fields_, variables_);
+      });
+   }
+};
+
+/**
+ * @brief Engine of AcousticField::Kernel::Phasor, via
+ * \ref ComputePhasorKernel() or \ref ComputeStructuredKernel(), with time
+ * phasors advanced by rotation. Batches of times are evaluated as
+ * \ref GEMMEngine.
+ */
+class PhasorEngine : public GEMMEngine
+{
+private:
+
+   /**
+    * @brief Per-axis spatial phasors \f$\cos(k_d x_d)\f$ of a structured
+    * grid, with the wave phase included in the first axis,
+    * [dim][wave][index along dim].
+    */
+   std::vector<double> axis_cos_k_x_;
+
+   /// Equivalent of \ref axis_cos_k_x_ for \f$\sin(k_d x_d)\f$.
+   std::vector<double> axis_sin_k_x_;
+
+   /// Time phasors \f$\cos(\omega t)\f$, sized by number of waves.
+   std::vector<double> cos_omt_;
+
+   /// Time phasors \f$\sin(\omega t)\f$, sized by number of waves.
+   std::vector<double> sin_omt_;
+
+   /// Time phasor rotations \f$\cos(\omega\Delta t)\f$ for \ref rotation_dt_.
+   std::vector<double> cos_omdt_;
+
+   /// Time phasor rotations \f$\sin(\omega\Delta t)\f$ for \ref rotation_dt_.
+   std::vector<double> sin_omdt_;
+
+   /// Timestep of the rotations, if computed.
+   std::optional<double> rotation_dt_;
+
+   /// Total number of points along each axis of \p grid.
+   static std::size_t NumAxisPoints(const StructuredGrid &grid)
+   {
+      return std::accumulate(grid.counts.begin(), grid.counts.end(),
+                              std::size_t(0));
+   }
+
+public:
+
+   explicit PhasorEngine(const AcousticField &field)
+   : GEMMEngine(field)
+   { }
+
+   /// Capabilities of every instance, as registered in EngineRegistry.
+   static EngineCapabilities StaticCapabilities()
+   {
+      EngineCapabilities caps;
+      caps.structured = true;
+      caps.variables = true;
+      caps.advances = true;
+      caps.autotuned = true;
+      return caps;
+   }
+
+   EngineCapabilities Capabilities() const override
+   {
+      return StaticCapabilities();
+   }
+
+   std::size_t MemoryEstimate(const WaveSeries &series) const override
+   {
+      const std::size_t num_spatial = series.grid ?
+                                       NumAxisPoints(*series.grid) :
+                                       series.num_pts;
+      return (2*num_spatial + 4)*series.num_waves*sizeof(double);
+   }
+
+   void Finalize(const WaveSeries &series) override
+   {
+      const int num_waves = series.num_waves;
+      if (series.grid)
+      {
+         // Compute + set per-axis phasors, with φ included in the first axis
+         const StructuredGrid &grid = *series.grid;
+         axis_cos_k_x_.resize(num_waves*NumAxisPoints(grid));
+         axis_sin_k_x_.resize(num_waves*NumAxisPoints(grid));
+         for (int w = 0; w < num_waves; w++)
+         {
+            std::size_t axis_offset = 0;
+            for (int d = 0; d < series.dim; d++)
+            {
+               const std::size_t n_d = grid.counts[d];
+               const double k_d = series.wave_ks[d*num_waves + w];
+               const std::size_t w_offset = axis_offset + w*n_d;
+               for (std::size_t i = 0; i < n_d; i++)
+               {
+                  const double k_x = k_d*(grid.origin[d] + i*grid.spacing[d])
+                                    + (d == 0 ? series.wave_phases[w] : 0.0);
+                  axis_cos_k_x_[w_offset + i] = std::cos(k_x);
+                  axis_sin_k_x_[w_offset + i] = std::sin(k_x);
+               }
+               axis_offset += num_waves*n_d;
+            }
+         }
+      }
+      else
+      {
+         GEMMEngine::Finalize(series);
+      }
+
+      cos_omt_.resize(num_waves);
+      sin_omt_.resize(num_waves);
+      cos_omdt_.resize(num_waves);
+      sin_omdt_.resize(num_waves);
+      rotation_dt_.reset();
+   }
+
+   void Prepare(const WaveSeries &series, const double t) override
+   {
+      for (int w = 0; w < series.num_waves; w++)
+      {
+         const double omt = series.wave_omegas[w]*t;
+         cos_omt_[w] = std::cos(omt);
+         sin_omt_[w] = std::sin(omt);
+      }
+   }
+
+   void Advance(const WaveSeries &series, const double dt) override
+   {
+      // Update rotations, only if timestep has changed
+      if (rotation_dt_ != dt)
+      {
+         for (int w = 0; w < series.num_waves; w++)
+         {
+            const double omdt = series.wave_omegas[w]*dt;
+            cos_omdt_[w] = std::cos(omdt);
+            sin_omdt_[w] = std::sin(omdt);
+         }
+         rotation_dt_ = dt;
+      }
+
+      // Rotate time phasors: e^{-iω(t+dt)} = e^{-iωt}e^{-iωdt}
+      for (int w = 0; w < series.num_waves; w++)
+      {
+         const double cos_omt = cos_omt_[w];
+         const double sin_omt = sin_omt_[w];
+         const double cos_omdt = cos_omdt_[w];
+         const double sin_omdt = sin_omdt_[w];
+         cos_omt_[w] = cos_omt*cos_omdt - sin_omt*sin_omdt;
+         sin_omt_[w] = sin_omt*cos_omdt + cos_omt*sin_omdt;
+      }
+   }
+
+   void Compute(const WaveSeries &series, [[maybe_unused]] const double t,
+                  double *rho, double *rhoV, double *rhoE) override
+   {
+      DispatchDim(series.dim, [&](const auto dim)
+      {
+         constexpr std::size_t TDim = decltype(dim)::value;
+         if (series.grid)
+         {
+            ComputeStructuredKernel<TDim>(series.grid->counts.data(),
+                              series.rho_bar, series.p_bar, series.U_bar,
+                              series.gamma, series.num_waves,
+                              series.rho_coeffs, series.rhoV_coeffs,
+                              cos_omt_.data(), sin_omt_.data(), 
+                              axis_cos_k_x_.data(), axis_sin_k_x_.data(), 
+                              rho, rhoV, rhoE, fields_, variables_);
+         }
+         else
+         {
+            ComputePhasorKernel<TDim>(series.num_pts, series.rho_bar,
+                              series.p_bar, series.U_bar, series.gamma,
+                              series.num_waves, series.rho_coeffs,
+                              series.rhoV_coeffs, cos_omt_.data(), 
+                              sin_omt_.data(), cos_k_dot_x_p_phi_.data(),
+                              sin_k_dot_x_p_phi_.data(), rho, rhoV, rhoE,
+                              fields_, variables_);
+         }
+      });
+   }
+
+   void ComputeBatch(const WaveSeries &series, const std::size_t num_times,
+                     const double *times, double *rho, double *rhoV,
+                     double *rhoE) override
+   {
+      if (series.grid)
+      {
+         ComputeEngine::ComputeBatch(series, num_times, times, rho, rhoV,
+                                       rhoE);
+      }
+      else
+      {
+         GEMMEngine::ComputeBatch(series, num_times, times, rho, rhoV, rhoE);
+      }
+   }
+};
+
+/**
+ * @brief Engine of AcousticField::Kernel::OnTheFly, via
+ * \ref ComputeOnTheFlyKernel().
+ */
+class OnTheFlyEngine : public ComputeEngine
+{
+private:
+
+   /// Conservative variables to write.
+   const FieldMask fields_;
+
+   /// Form of the variables to write.
+   const Variables variables_;
+
+public:
+
+   explicit OnTheFlyEngine(const AcousticField &field)
+   : fields_(field.OutputFields()),
+     variables_(field.OutputVariables())
+   { }
+
+   /// Capabilities of every instance, as registered in EngineRegistry.
+   static EngineCapabilities StaticCapabilities()
+   {
+      EngineCapabilities caps;
+      caps.variables = true;
+      caps.autotuned = true;
+      return caps;
+   }
+
+   EngineCapabilities Capabilities() const override
+   {
+      return StaticCapabilities();
+   }
+
+   std::size_t MemoryEstimate(const WaveSeries&) const override
+   {
+      return 0;
+   }
+
+   void Finalize(const WaveSeries&) override { }
+
+   void Compute(const WaveSeries &series, const double t, double *rho,
+                  double *rhoV, double *rhoE) override
+   {
+      DispatchDim(series.dim, [&](const auto dim)
+      {
+         ComputeOnTheFlyKernel<decltype(dim)::value>(series.num_pts,
+                              series.rho_bar, series.p_bar, series.U_bar,
+                              series.gamma, series.num_waves, t,
+                              series.rho_coeffs, series.rhoV_coeffs,
+                              series.wave_omegas, series.wave_ks, 
+                              series.wave_phases, series.coords, rho, rhoV,
+                              rhoE, fields_, variables_);
+      });
+   }
+};
+
+/**
+ * @brief Engine of AcousticField::Kernel::NUFFT, via
+ * \ref ComputeNUFFTKernel().
+ */
+class NUFFTEngine : public ComputeEngine
+{
+private:
+
+   /// Relative tolerance.
+   const double tolerance_;
+
+   /// Conservative variables to write.
+   const FieldMask fields_;
+
+   /// Form of the variables to write.
+   const Variables variables_;
+
+   /// Plan, constructed in \ref Finalize().
+   NUFFTPlan plan_;
+
+public:
+
+   explicit NUFFTEngine(const AcousticField &field)
+   : tolerance_(field.NUFFTTolerance()),
+     fields_(field.OutputFields()),
+     variables_(field.OutputVariables())
+   { }
+
+   /// Capabilities of every instance, as registered in EngineRegistry.
+   static EngineCapabilities StaticCapabilities()
+   {
+      EngineCapabilities caps;
+      caps.variables = true;
+      return caps;
+   }
+
+   EngineCapabilities Capabilities() const override
+   {
+      return StaticCapabilities();
+   }
+
+   /// Excludes the FFT grid, which is only sized in \ref Finalize().
+   std::size_t MemoryEstimate(const WaveSeries &series) const override
+   {
+      return series.num_pts*sizeof(std::complex<double>) +
+               series.num_waves*(sizeof(std::complex<double>) +
+                                 2*sizeof(int));
+   }
+
+   void Finalize(const WaveSeries &series) override
+   {
+      // Density + velocity channels, with the velocity only for the 
+      // momentum or energy
+      const bool velocity = HasField(fields_, Field::Momentum) || 
+                              HasField(fields_, Field::Energy);
+      plan_ = NUFFTPlan(series.dim, series.num_pts, series.coords,
+                        series.num_waves, series.wave_ks, 
+                        velocity ? series.dim + 1 : 1, tolerance_);
+   }
+
+   void Compute(const WaveSeries &series, const double t, double *rho,
+                  double *rhoV, double *rhoE) override
+   {
+      DispatchDim(series.dim, [&](const auto dim)
+      {
+         ComputeNUFFTKernel<decltype(dim)::value>(series.num_pts,
+                              series.rho_bar, series.p_bar, series.U_bar,
+                              series.gamma, series.num_waves, t,
+                              series.rho_coeffs, series.rhoV_coeffs,
+                              series.wave_omegas, series.wave_ks, 
+                              series.wave_phases, series.coords, plan_, 
+                              rho, rhoV, rhoE, fields_, variables_);
+      });
+   }
+};
+
+/**
+ * @brief Maximum phase \f$|\vec{k}\cdot\vec{\delta}|\f$ from the center of
+ * a tile in \ref TileExpansionEngine.
+ */
+constexpr double kMaxTilePhase = 1.0;
+
+/**
+ * @brief Lowest order of the Taylor expansion of \f$e^{i\psi}\f$ for
+ * \f$|\psi|\le\f$ \p max_phase with remainder below \p tol, or -1 if
+ * above \ref kMaxExpansionOrder.
+ */
+int ExpansionOrder(double max_phase, double tol)
+{
+   double remainder = 1.0;
+   for (int order = 0; order <= kMaxExpansionOrder; order++)
+   {
+      remainder *= max_phase/(order + 1);
+      if (remainder <= tol)
+      {
+         return order;
+      }
+   }
+   return -1;
+}
+
+/**
+ * @brief Engine of AcousticField::Kernel::TileExpansion, via
+ * \ref ComputeExpansionKernel().
+ */
+class TileExpansionEngine : public ComputeEngine
+{
+private:
+
+   /// Relative tolerance.
+   const double tolerance_;
+
+   /// Conservative variables to write.
+   const FieldMask fields_;
+
+   /// Form of the variables to write.
+   const Variables variables_;
+
+   /// Index of the first point of each tile in \ref tile_pts_.
+   std::vector<std::size_t> tile_offsets_;
+
+   /// Point indices, ordered by tile.
+   std::vector<std::size_t> tile_pts_;
+
+   /// Center of each tile, [tile][dim].
+   std::vector<double> tile_centers_;
+
+   /// Taylor expansion order of each tile, or -1 if evaluated exactly.
+   std::vector<int> tile_orders_;
+
+   /// Offset of each point from its tile center, [dim][point of tile_pts_].
+   std::vector<double> tile_deltas_;
+
+public:
+
+   explicit TileExpansionEngine(const AcousticField &field)
+   : tolerance_(field.ExpansionTolerance()),
+     fields_(field.OutputFields()),
+     variables_(field.OutputVariables())
+   { }
+
+   /// Capabilities of every instance, as registered in EngineRegistry.
+   static EngineCapabilities StaticCapabilities()
+   {
+      EngineCapabilities caps;
+      caps.variables = true;
+      return caps;
+   }
+
+   EngineCapabilities Capabilities() const override
+   {
+      return StaticCapabilities();
+   }
+
+   /// Upper bound, with a tile per point.
+   std::size_t MemoryEstimate(const WaveSeries &series) const override
+   {
+      return series.num_pts*(2*sizeof(std::size_t) + sizeof(int) +
+                              2*series.dim*sizeof(double));
+   }
+
+   /**
+    * @brief Bin points into tiles small enough relative to the shortest
+    * wavelength for a short expansion about each tile center.
+    */
+   void Finalize(const WaveSeries &series) override
+   {
+      const int dim = series.dim;
+      const std::size_t num_pts = series.num_pts;
+      tile_offsets_.assign(1, 0);
+      if (num_pts == 0)
+      {
+         tile_orders_.clear();
+         return;
+      }
+
+      double k_max = 0.0;
+      for (int w = 0; w < series.num_waves; w++)
+      {
+         k_max = std::max(k_max, std::abs(series.wave_k_mags[w]));
+      }
+
+      // Cell of each point on a uniform grid of cubes, with edge such that
+      // |k·δ| <= kMaxTilePhase from the center of any cube
+      const double edge = (k_max > 0.0) ?
+                           2*kMaxTilePhase/(k_max*std::sqrt(dim)) :
+                           std::numeric_limits<double>::infinity();
+      std::vector<std::int64_t> cells(num_pts*dim);
+      for (int d = 0; d < dim; d++)
+      {
+         const double *x_d = series.coords + d*num_pts;
+         const double x_min = *std::min_element(x_d, x_d + num_pts);
+         for (std::size_t i = 0; i < num_pts; i++)
+         {
+            cells[i*dim + d] = static_cast<std::int64_t>(
+                                       std::floor((x_d[i] - x_min)/edge));
+         }
+      }
+
+      // Order points by cell, with each occupied cell forming a tile
+      std::vector<std::size_t> &pts = tile_pts_;
+      pts.resize(num_pts);
+      std::iota(pts.begin(), pts.end(), std::size_t(0));
+      const auto Cell = [&](const std::size_t i)
+      {
+         return std::span<const std::int64_t>(cells.data() + i*dim, dim);
+      };
+      std::sort(pts.begin(), pts.end(), [&](const std::size_t a,
+                                             const std::size_t b)
+                {
+                  return std::ranges::lexicographical_compare(Cell(a),
+                                                               Cell(b));
+                });
+      for (std::size_t i = 1; i <= num_pts; i++)
+      {
+         if (i == num_pts || !std::ranges::equal(Cell(pts[i-1]),
+                                                   Cell(pts[i])))
+         {
+            tile_offsets_.push_back(i);
+         }
+      }
+
+      // Center each tile on the bounding box of its points, and set the
+      // order from its radius
+      const std::size_t num_tiles = tile_offsets_.size() - 1;
+      tile_centers_.resize(num_tiles*dim);
+      tile_orders_.resize(num_tiles);
+      tile_deltas_.resize(dim*num_pts);
+      for (std::size_t b = 0; b < num_tiles; b++)
+      {
+         const std::size_t begin = tile_offsets_[b];
+         const std::size_t end = tile_offsets_[b+1];
+         double *x_c = tile_centers_.data() + b*dim;
+         for (int d = 0; d < dim; d++)
+         {
+            const double *x_d = series.coords + d*num_pts;
+            double lo = x_d[pts[begin]], hi = lo;
+            for (std::size_t i = begin; i < end; i++)
+            {
+               lo = std::min(lo, x_d[pts[i]]);
+               hi = std::max(hi, x_d[pts[i]]);
+            }
+            x_c[d] = 0.5*(lo + hi);
+         }
+
+         double radius = 0.0;
+         for (std::size_t i = begin; i < end; i++)
+         {
+            double r2 = 0.0;
+            for (int d = 0; d < dim; d++)
+            {
+               const double delta = series.coords[d*num_pts + pts[i]] -
+                                       x_c[d];
+               tile_deltas_[d*num_pts + i] = delta;
+               r2 += delta*delta;
+            }
+            radius = std::max(radius, std::sqrt(r2));
+         }
+         tile_orders_[b] = ExpansionOrder(k_max*radius, tolerance_);
+      }
+   }
+
+   void Compute(const WaveSeries &series, const double t, double *rho,
+                  double *rhoV, double *rhoE) override
+   {
+      DispatchDim(series.dim, [&](const auto dim)
+      {
+         ComputeExpansionKernel<decltype(dim)::value>(series.num_pts,
+                              series.rho_bar, series.p_bar, series.U_bar,
+                              series.gamma, series.num_waves, t,
+                              series.rho_coeffs, series.rhoV_coeffs,
+                              series.wave_omegas, series.wave_ks, 
+                              series.wave_phases, tile_orders_.size(), 
+                              tile_offsets_.data(), tile_pts_.data(), 
+                              tile_centers_.data(), tile_orders_.data(), 
+                              tile_deltas_.data(), rho, rhoV, rhoE, 
+                              fields_, variables_);
+      });
+   }
+};
+
+/**
+ * @brief Number of Gaussian probes per block of the randomized range finder
+ * of \ref LowRankEngine. The residual of a block bounds that of the matrix
+ * with probability \f$1-10^{-10}\f$ for at least 10 probes.
+ */
+constexpr std::size_t kLowRankProbes = 16;
+
+/**
+ * @brief Engine of AcousticField::Kernel::LowRank, via
+ * \ref ComputeLowRankKernel().
+ */
+class LowRankEngine : public ComputeEngine
+{
+private:
+
+   /// Relative tolerance.
+   const double tolerance_;
+
+   /// Conservative variables to write.
+   const FieldMask fields_;
+
+   /// Form of the variables to write.
+   const Variables variables_;
+
+   /// Rank of the factorization, or -1 if evaluated by the direct sum.
+   int rank_ = -1;
+
+   /// Whether \ref Finalize() has been called.
+   bool finalized_ = false;
+
+   /// Orthonormal basis, [row][rank].
+   std::vector<double> basis_;
+
+   /// Factor of each point in the basis, [point][rank].
+   std::vector<double> factors_;
+
+   /// Maximum rank of \p series before falling back to the direct sum.
+   static std::size_t MaxRank(const WaveSeries &series)
+   {
+      return std::min(std::size_t(series.num_waves), series.num_pts)/2;
+   }
+
+   /**
+    * @brief Least ratio \f$\|a\|_1/\|a\|_2\f$ of the coefficients 
+    * \f$a\f$ of each nonzero series of \p series, bounding the error of
+    * a series at a point relative to the sum of its absolute coefficients
+    * by the residual of its column of phasors.
+    */
+   static double AmplitudeScale(const WaveSeries &series)
+   {
+      const std::size_t nw = series.num_waves;
+      double scale = std::numeric_limits<double>::infinity();
+      const auto Scale = [&](const double *coeffs)
+      {
+         double sum_abs = 0.0, sum_sq = 0.0;
+         for (std::size_t w = 0; w < nw; w++)
+         {
+            sum_abs += std::abs(coeffs[w]);
+            sum_sq += coeffs[w]*coeffs[w];
+         }
+         if (sum_sq > 0.0)
+         {
+            scale = std::min(scale, sum_abs/std::sqrt(sum_sq));
+         }
+      };
+      Scale(series.rho_coeffs);
+      for (int d = 0; d < series.dim; d++)
+      {
+         Scale(series.rhoV_coeffs + d*nw);
+      }
+      return std::isinf(scale) ? 1.0 : scale;
+   }
+
+   /**
+    * @brief Evaluate the matrix \f$M\f$ of spatial phasors of \p series
+    * (see \ref ComputeLowRankKernel()), [row][point].
+    */
+   static std::vector<double> Phasors(const WaveSeries &series)
+   {
+      const int nw = series.num_waves;
+      const std::size_t num_pts = series.num_pts;
+      std::vector<double> phasors(2*std::size_t(nw)*num_pts);
+#ifdef JABBER_WITH_OPENMP
+      #pragma omp parallel for
+#endif // JABBER_WITH_OPENMP
+      for (int w = 0; w < nw; w++)
+      {
+         double *cos_w = phasors.data() + w*num_pts;
+         double *sin_w = phasors.data() + (nw + w)*num_pts;
+         for (std::size_t i = 0; i < num_pts; i++)
+         {
+            double theta = series.wave_phases[w];
+            for (int d = 0; d < series.dim; d++)
+            {
+               theta += series.wave_ks[d*nw + w]*series.coords[d*num_pts + i];
+            }
+            cos_w[i] = std::cos(theta);
+            sin_w[i] = std::sin(theta);
+         }
+      }
+      return phasors;
+   }
+
+public:
+
+   explicit LowRankEngine(const AcousticField &field)
+   : tolerance_(field.LowRankTolerance()),
+     fields_(field.OutputFields()),
+     variables_(field.OutputVariables())
+   { }
+
+   /// Capabilities of every instance, as registered in EngineRegistry.
+   static EngineCapabilities StaticCapabilities()
+   {
+      EngineCapabilities caps;
+      caps.variables = true;
+      return caps;
+   }
+
+   EngineCapabilities Capabilities() const override
+   {
+      return StaticCapabilities();
+   }
+
+   /**
+    * @brief Upper bound, at the maximum rank, including \f$M\f$ as held
+    * during \ref Finalize(). Once finalized, the memory of the factors of
+    * \ref rank_, or zero if evaluated by the direct sum.
+    */
+   std::size_t MemoryEstimate(const WaveSeries &series) const override
+   {
+      const std::size_t rows = 2*std::size_t(series.num_waves);
+      if (finalized_)
+      {
+         return (basis_.size() + factors_.size())*sizeof(double);
+      }
+      return (MaxRank(series)*(rows + series.num_pts) + 
+               kLowRankProbes*(rows + series.num_pts) +
+               rows*series.num_pts)*sizeof(double);
+   }
+
+   /**
+    * @brief Find an orthonormal basis \f$Q\f$ of the range of the matrix 
+    * \f$M\f$ of spatial phasors (see \ref ComputeLowRankKernel()) by the
+    * adaptive randomized range finder of Halko, Martinsson, and Tropp 
+    * (2011), and the factor \f$B=Q^TM\f$.
+    * 
+    * @details \f$M\f$ is evaluated once, then sampled by blocks of 
+    * \ref kLowRankProbes Gaussian vectors \f$\omega_j\f$ of variance 
+    * 1/\p num_pts, and the basis is extended by the residuals 
+    * \f$(I-QQ^T)M\omega_j\f$ until 
+    * \f$10\sqrt{2/\pi}\max_j\|(I-QQ^T)M\omega_j\|\f$ is within the 
+    * tolerance, scaled by the least ratio \f$\|a\|_1/\|a\|_2\f$ of the 
+    * coefficients \f$a\f$ of any series. 
+    * 
+    * As \f$E\|(I-QQ^T)M\omega_j\|^2\f$ is then the mean over the points
+    * of the squared residual of their columns of \f$M\f$, and the error 
+    * of a series at a point is at most \f$\|a\|_2\f$ times that of its 
+    * column, each series is within the tolerance of the sum of its 
+    * absolute coefficients, with the factor \f$10\sqrt{2/\pi}\f$ of 
+    * Halko et al. as a margin for columns above the mean. \f$M\f$ is only
+    * held during this call, such that it costs one evaluation of the 
+    * phasors and O(waves x points) memory.
+    */
+   void Finalize(const WaveSeries &series) override
+   {
+      const std::size_t nw = series.num_waves;
+      const std::size_t num_pts = series.num_pts;
+      const std::size_t rows = 2*nw;
+      const std::size_t max_rank = MaxRank(series);
+      rank_ = -1;
+      finalized_ = true;
+      basis_.clear();
+      factors_.clear();
+      if (max_rank == 0)
+      {
+         return;
+      }
+
+      const std::vector<double> phasors = Phasors(series);
+      const double threshold = tolerance_*AmplitudeScale(series)/
+                                 (10.0*std::sqrt(2.0/M_PI));
+      std::mt19937_64 gen(0);
+      std::normal_distribution<double> normal(0.0, 
+                                       1.0/std::sqrt(double(num_pts)));
+      std::vector<double> omega(num_pts*kLowRankProbes);
+      std::vector<double> samples(kLowRankProbes*rows);
+
+      // Basis built by column, [rank][row]
+      std::vector<double> cols;
+      std::size_t rank = 0;
+      const auto Orthogonalize = [&](double *y)
+      {
+         // Twice, for orthogonality to round-off
+         for (int pass = 0; pass < 2; pass++)
+         {
+            for (std::size_t k = 0; k < rank; k++)
+            {
+               const double *q = cols.data() + k*rows;
+               const double dot = std::inner_product(q, q + rows, y, 0.0);
+               for (std::size_t r = 0; r < rows; r++)
+               {
+                  y[r] -= dot*q[r];
+               }
+            }
+         }
+         return std::sqrt(std::inner_product(y, y + rows, y, 0.0));
+      };
+
+      while (true)
+      {
+         // Sample the range, [probe][row]
+         for (double &o : omega)
+         {
+            o = normal(gen);
+         }
+#ifdef JABBER_WITH_OPENMP
+         #pragma omp parallel for
+#endif // JABBER_WITH_OPENMP
+         for (std::size_t r = 0; r < rows; r++)
+         {
+            const double *m_r = phasors.data() + r*num_pts;
+            double y_r[kLowRankProbes] = {};
+            for (std::size_t i = 0; i < num_pts; i++)
+            {
+               const double *omega_i = omega.data() + i*kLowRankProbes;
+               for (std::size_t j = 0; j < kLowRankProbes; j++)
+               {
+                  y_r[j] += m_r[i]*omega_i[j];
+               }
+            }
+            for (std::size_t j = 0; j < kLowRankProbes; j++)
+            {
+               samples[j*rows + r] = y_r[j];
+            }
+         }
+
+         double residual = 0.0;
+         for (std::size_t j = 0; j < kLowRankProbes; j++)
+         {
+            residual = std::max(residual, 
+                                 Orthogonalize(samples.data() + j*rows));
+         }
+         if (residual <= threshold)
+         {
+            break;
+         }
+
+         for (std::size_t j = 0; j < kLowRankProbes; j++)
+         {
+            double *y = samples.data() + j*rows;
+            const double norm = Orthogonalize(y);
+            if (norm <= threshold)
+            {
+               continue;
+            }
+            if (rank == max_rank)
+            {
+               return;
+            }
+            cols.resize((rank + 1)*rows);
+            std::transform(y, y + rows, cols.begin() + rank*rows,
+                           [&](const double y_r) { return y_r/norm; });
+            rank++;
+         }
+      }
+
+      basis_.resize(rows*rank);
+      for (std::size_t k = 0; k < rank; k++)
+      {
+         for (std::size_t r = 0; r < rows; r++)
+         {
+            basis_[r*rank + k] = cols[k*rows + r];
+         }
+      }
+      rank_ = rank;
+
+      // Factor of each point, projecting its column of M onto the basis
+      factors_.assign(num_pts*rank, 0.0);
+#ifdef JABBER_WITH_OPENMP
+      #pragma omp parallel for
+#endif // JABBER_WITH_OPENMP
+      for (std::size_t i = 0; i < num_pts; i++)
+      {
+         double *f = factors_.data() + i*rank;
+         for (std::size_t r = 0; r < rows; r++)
+         {
+            const double m_ri = phasors[r*num_pts + i];
+            const double *q_r = basis_.data() + r*rank;
+            for (std::size_t k = 0; k < rank; k++)
+            {
+               f[k] += m_ri*q_r[k];
+            }
+         }
+      }
+   }
+
+   void Compute(const WaveSeries &series, const double t, double *rho,
+                  double *rhoV, double *rhoE) override
+   {
+      DispatchDim(series.dim, [&](const auto dim)
+      {
+         if (rank_ < 0)
+         {
+            ComputeOnTheFlyKernel<decltype(dim)::value>(series.num_pts,
+                              series.rho_bar, series.p_bar, series.U_bar,
+                              series.gamma, series.num_waves, t,
+                              series.rho_coeffs, series.rhoV_coeffs,
+                              series.wave_omegas, series.wave_ks, 
+                              series.wave_phases, series.coords, rho, rhoV,
+                              rhoE, fields_, variables_);
+            return;
+         }
+         ComputeLowRankKernel<decltype(dim)::value>(series.num_pts,
+                              series.rho_bar, series.p_bar, series.U_bar,
+                              series.gamma, series.num_waves, t,
+                              series.rho_coeffs, series.rhoV_coeffs,
+                              series.wave_omegas, rank_, basis_.data(), 
+                              factors_.data(), rho, rhoV, rhoE, fields_,
+                              variables_);
+      });
+   }
+};
+
+/**
+ * @brief Ratio of the highest to lowest frequency bound of each band of
+ * \ref MultiRateEngine.
+ */
+constexpr double kBandRatio = 2.0;
+
+/**
+ * @brief Minimum number of calls per refresh for a band of 
+ * \ref MultiRateEngine to be interpolated, as each refresh costs about
+ * twice its direct evaluation.
+ */
+constexpr double kMinRefreshCalls = 2.0;
+
+/**
+ * @brief Engine of AcousticField::Kernel::MultiRate, via 
+ * \ref ComputeBandKernel() and \ref ComputeMultiRateKernel().
+ */
+class MultiRateEngine : public ComputeEngine
+{
+private:
+
+   /// Refresh index of an empty slot.
+   static constexpr std::int64_t kEmptySlot =
+                                 std::numeric_limits<std::int64_t>::min();
+
+   /// Bound of the refresh indices, within std::int64_t.
+   static constexpr double kMaxRefreshIdx = 0x1p62;
+
+   /// Waves of a frequency band, and its refreshes.
+   struct Band
+   {
+      /// Number of waves.
+      int num_waves = 0;
+
+      /**
+       * @brief Interval between refreshes, within which the band is 
+       * interpolated to within the tolerance.
+       */
+      double interval = 0.0;
+
+      /// Series coefficients, frequencies, and phases, as in WaveSeries.
+      std::vector<double> rho_coeffs, rhoV_coeffs, omegas, ks, phases;
+
+      /// Refresh index of each slot of \ref knots, or \ref kEmptySlot.
+      std::array<std::int64_t, 2> knot_idxs = {kEmptySlot, kEmptySlot};
+
+      /**
+       * @brief Perturbations and time derivatives at each refresh of 
+       * \ref knot_idxs, allocated on the first refresh. Ordered as 
+       * [slot][perturbation, derivative][series][point].
+       */
+      std::vector<double> knots;
+   };
+
+   /// Relative tolerance.
+   const double tolerance_;
+
+   /// Conservative variables to write.
+   const FieldMask fields_;
+
+   /// Form of the variables to write.
+   const Variables variables_;
+
+   /// Bands of the waves, in increasing frequency.
+   std::vector<Band> bands_;
+
+   /// Sum of the bands evaluated directly, [series][point].
+   std::vector<double> direct_;
+
+   /**
+    * @brief Terms of \ref ComputeMultiRateKernel() and their weights, 
+    * reserved in \ref Finalize() for \ref direct_ and four per band.
+    */
+   std::vector<const double*> terms_;
+   std::vector<double> weights_;
+
+   /// Time of the previous \ref Compute(), or NaN if none.
+   double prev_time_ = std::numeric_limits<double>::quiet_NaN();
+
+   /// Band of each wave of \p series, numbered from zero.
+   static std::vector<int> BandIndices(const WaveSeries &series)
+   {
+      double omega_min = std::numeric_limits<double>::infinity();
+      for (int w = 0; w < series.num_waves; w++)
+      {
+         const double omega = std::abs(series.wave_omegas[w]);
+         if (omega > 0.0)
+         {
+            omega_min = std::min(omega_min, omega);
+         }
+      }
+
+      // Constant waves are added to the lowest band
+      std::vector<int> idxs(series.num_waves, 0);
+      for (int w = 0; w < series.num_waves; w++)
+      {
+         const double omega = std::abs(series.wave_omegas[w]);
+         if (omega > 0.0)
+         {
+            idxs[w] = std::floor(std::log(omega/omega_min)/
+                                 std::log(kBandRatio));
+         }
+      }
+      return idxs;
+   }
+
+   /**
+    * @brief Evaluate the perturbations and derivatives of \p band at the
+    * refresh \p idx into slot \p slot.
+    */
+   void Refresh(const WaveSeries &series, Band &band, int slot, 
+                  std::int64_t idx) const
+   {
+      const std::size_t size = (series.dim + 1)*series.num_pts;
+      band.knots.resize(4*size);
+      double *sums = band.knots.data() + 2*slot*size;
+      std::fill_n(sums, 2*size, 0.0);
+      DispatchDim(series.dim, [&](const auto dim)
+      {
+         ComputeBandKernel<decltype(dim)::value>(series.num_pts, 
+                              band.num_waves, idx*band.interval,
+                              band.rho_coeffs.data(), 
+                              band.rhoV_coeffs.data(), band.omegas.data(),
+                              band.ks.data(), band.phases.data(),
+                              series.coords, sums, sums + size, fields_);
+      });
+      band.knot_idxs[slot] = idx;
+   }
+
+public:
+
+   explicit MultiRateEngine(const AcousticField &field)
+   : tolerance_(field.MultiRateTolerance()),
+     fields_(field.OutputFields()),
+     variables_(field.OutputVariables())
+   { }
+
+   /// Capabilities of every instance, as registered in EngineRegistry.
+   static EngineCapabilities StaticCapabilities()
+   {
+      EngineCapabilities caps;
+      caps.variables = true;
+      return caps;
+   }
+
+   EngineCapabilities Capabilities() const override
+   {
+      return StaticCapabilities();
+   }
+
+   /// Upper bound, with every band interpolated.
+   std::size_t MemoryEstimate(const WaveSeries &series) const override
+   {
+      const std::vector<int> idxs = BandIndices(series);
+      const std::size_t num_bands = idxs.empty() ? 0 : 
+                                       *std::ranges::max_element(idxs) + 1;
+      return ((4*num_bands + 1)*(series.dim + 1)*series.num_pts + 
+               (series.dim + 4)*std::size_t(series.num_waves))*sizeof(double);
+   }
+
+   /**
+    * @brief Sort the waves into bands of frequencies within 
+    * \ref kBandRatio, and set the refresh interval of each.
+    * 
+    * @details The cubic Hermite interpolation of a series 
+    * \f$\sum_j c_j\cos(\theta_j-\omega_j t)\f$ over an interval \f$h\f$
+    * is within \f$\frac{h^4}{384}\sum_j|c_j|\omega_j^4\f$, such that each 
+    * band's interval is set for it to be within its share of the tolerance
+    * of the sum of absolute wave amplitudes.
+    */
+   void Finalize(const WaveSeries &series) override
+   {
+      const int nw = series.num_waves;
+      const std::vector<int> idxs = BandIndices(series);
+
+      // Number the occupied bands in increasing frequency
+      std::vector<int> band_ids(idxs.empty() ? 0 : 
+                                 *std::ranges::max_element(idxs) + 1, -1);
+      for (const int i : idxs)
+      {
+         band_ids[i] = 0;
+      }
+      int num_bands = 0;
+      for (int &id : band_ids)
+      {
+         if (id == 0)
+         {
+            id = num_bands++;
+         }
+      }
+
+      // Count the waves and interpolation error bound of each band
+      bands_.assign(num_bands, Band{});
+      std::vector<double> bounds(num_bands, 0.0);
+      double amp_sum = 0.0;
+      for (int w = 0; w < nw; w++)
+      {
+         const int b = band_ids[idxs[w]];
+         const double amp = std::abs(series.rho_coeffs[w]);
+         bands_[b].num_waves++;
+         bounds[b] += amp*std::pow(series.wave_omegas[w], 4);
+         amp_sum += amp;
+      }
+
+      // Intervals, or zero for bands always evaluated directly
+      const double share = tolerance_*amp_sum/std::max(num_bands, 1);
+      for (int b = 0; b < num_bands; b++)
+      {
+         Band &band = bands_[b];
+         band.interval = (bounds[b] > 0.0) ? 
+                              std::pow(384.0*share/bounds[b], 0.25) : 0.0;
+         band.rho_coeffs.resize(band.num_waves);
+         band.rhoV_coeffs.resize(series.dim*band.num_waves);
+         band.omegas.resize(band.num_waves);
+         band.ks.resize(series.dim*band.num_waves);
+         band.phases.resize(band.num_waves);
+         band.num_waves = 0;
+      }
+
+      // Gather the waves of each band
+      for (int w = 0; w < nw; w++)
+      {
+         Band &band = bands_[band_ids[idxs[w]]];
+         const int nb = band.rho_coeffs.size();
+         const int j = band.num_waves++;
+         band.rho_coeffs[j] = series.rho_coeffs[w];
+         band.omegas[j] = series.wave_omegas[w];
+         band.phases[j] = series.wave_phases[w];
+         for (int d = 0; d < series.dim; d++)
+         {
+            band.rhoV_coeffs[d*nb + j] = series.rhoV_coeffs[d*nw + w];
+            band.ks[d*nb + j] = series.wave_ks[d*nw + w];
+         }
+      }
+
+      direct_.resize((series.dim + 1)*series.num_pts);
+      terms_.clear();
+      terms_.reserve(1 + 4*num_bands);
+      weights_.clear();
+      weights_.reserve(1 + 4*num_bands);
+      prev_time_ = std::numeric_limits<double>::quiet_NaN();
+   }
+
+   /**
+    * @brief Evaluate each band by interpolation between the refreshes 
+    * bounding \p t if both are already evaluated, or if called at 
+    * successive increasing times closer than its interval by at least 
+    * \ref kMinRefreshCalls. Otherwise, evaluate it directly.
+    * 
+    * @details Refreshes are at integer multiples of the interval, such that
+    * each is evaluated once as the time advances through it. Repeated or 
+    * earlier times within the refreshed interval, as of the stages of a 
+    * Runge-Kutta step, are thus also interpolated.
+    */
+   void Compute(const WaveSeries &series, const double t, double *rho,
+                  double *rhoV, double *rhoE) override
+   {
+      const std::size_t size = (series.dim + 1)*series.num_pts;
+      const double dt = t - prev_time_;
+      prev_time_ = t;
+
+      std::fill(direct_.begin(), direct_.end(), 0.0);
+      terms_.assign(1, direct_.data());
+      weights_.assign(1, 1.0);
+      for (Band &band : bands_)
+      {
+         const double h = band.interval;
+         const double pos = (h > 0.0) ? t/h : 0.0;
+         const bool indexed = h > 0.0 && std::abs(pos) < kMaxRefreshIdx;
+         const std::int64_t idx = indexed ? std::floor(pos) : 0;
+         const auto Slot = [&](const std::int64_t i) -> int
+         {
+            return (band.knot_idxs[0] == i) ? 0 : 
+                     (band.knot_idxs[1] == i) ? 1 : -1;
+         };
+         int slot_a = Slot(idx);
+         int slot_b = Slot(idx + 1);
+         const bool refreshed = slot_a >= 0 && slot_b >= 0;
+         if (!indexed || 
+               !(refreshed || (dt > 0.0 && kMinRefreshCalls*dt <= h)))
+         {
+            DispatchDim(series.dim, [&](const auto dim)
+            {
+               ComputeBandKernel<decltype(dim)::value>(series.num_pts, 
+                              band.num_waves, t, band.rho_coeffs.data(), 
+                              band.rhoV_coeffs.data(), band.omegas.data(),
+                              band.ks.data(), band.phases.data(),
+                              series.coords, direct_.data(), nullptr, 
+                              fields_);
+            });
+            continue;
+         }
+
+         // Refresh the bounding refreshes not already in a slot
+         if (slot_a < 0)
+         {
+            slot_a = (slot_b == 0) ? 1 : 0;
+            Refresh(series, band, slot_a, idx);
+         }
+         if (slot_b < 0)
+         {
+            slot_b = 1 - slot_a;
+            Refresh(series, band, slot_b, idx + 1);
+         }
+
+         // Cubic Hermite basis
+         const double s = pos - idx;
+         const double r = 1.0 - s;
+         const double *knot_a = band.knots.data() + 2*slot_a*size;
+         const double *knot_b = band.knots.data() + 2*slot_b*size;
+         terms_.insert(terms_.end(), {knot_a, knot_a + size, knot_b, 
+                                       knot_b + size});
+         weights_.insert(weights_.end(), {(1.0 + 2.0*s)*r*r, h*s*r*r,
+                                             s*s*(3.0 - 2.0*s), -h*s*s*r});
+      }
+
+      DispatchDim(series.dim, [&](const auto dim)
+      {
+         ComputeMultiRateKernel<decltype(dim)::value>(series.num_pts,
+                              series.rho_bar, series.p_bar, series.U_bar,
+                              series.gamma, terms_.size(), terms_.data(),
+                              weights_.data(), rho, rhoV, rhoE, fields_,
+                              variables_);
+      });
+   }
+};
+
+/**
+ * @brief Engine of AcousticField::IsCollapsed(), evaluating each group of
+ * waves sharing a direction once per unique projection of the points via
+ * \ref ComputeCollapsedKernel(), where cheaper than evaluating each wave 
+ * at each point. Otherwise, the wrapped engine is used. The collapsed sums
+ * are in double precision, in an order independent of the number of 
+ * threads, so collapsing is skipped in mixed precision.
+ */
+class CollapsedEngine : public ComputeEngine
+{
+private:
+
+   /// Engine used if not collapsed.
+   const std::unique_ptr<ComputeEngine> inner_;
+
+   /// Whether the series may be collapsed.
+   const bool collapsing_;
+
+   /// Accuracy of the cosine evaluation.
+   const Accuracy accuracy_;
+
+   /// Outputs to write.
+   const FieldMask fields_;
+
+   /// Form of the output variables.
+   const Variables variables_;
+
+   /// Whether the series is collapsed, set in \ref Finalize().
+   bool collapsed_ = false;
+
+   /**
+    * @brief Index of the first unique projection of each group in 
+    * \ref projs_, sized number of groups + 1.
+    */
+   std::vector<std::size_t> proj_offsets_;
+
+   /**
+    * @brief Unique projections \f$\hat{k}\cdot\vec{x}\f$ of all points
+    * onto the direction of each group.
+    */
+   std::vector<double> projs_;
+
+   /**
+    * @brief Index of the projection of each point within its group's 
+    * range of \ref projs_, sized number of groups x number of points with
+    * ordering [group][point].
+    */
+   std::vector<std::size_t> pt_proj_idxs_;
+
+   /// Workspace for the sums at each of \ref projs_, sized 2 x its size.
+   std::vector<double> proj_sums_;
+
+   /**
+    * @brief Momentum series coefficients along each wave direction,
+    * \f$\frac{1}{\bar{\rho}\bar{c}}(\pm 1)p'_j\f$, sized number of waves.
+    */
+   std::vector<double> proj_rhoV_coeffs_;
+
+public:
+
+   CollapsedEngine(const AcousticField &field, 
+                     std::unique_ptr<ComputeEngine> inner)
+   : inner_(std::move(inner)),
+     collapsing_(field.Collapsing() && !field.MixedPrecision()),
+     accuracy_(field.CosineAccuracy()),
+     fields_(field.OutputFields()),
+     variables_(field.OutputVariables())
+   { }
+
+   EngineCapabilities Capabilities() const override
+   {
+      if (!collapsed_)
+      {
+         return inner_->Capabilities();
+      }
+      EngineCapabilities caps;
+      caps.variables = true;
+      return caps;
+   }
+
+   EnginePath Path() const override
+   {
+      return collapsed_ ? EnginePath::Collapsed : inner_->Path();
+   }
+
+   std::size_t MemoryEstimate(const WaveSeries &series) const override
+   {
+      if (!collapsed_)
+      {
+         return inner_->MemoryEstimate(series);
+      }
+      return (proj_offsets_.size() + pt_proj_idxs_.size())*
+                  sizeof(std::size_t) + 
+               (projs_.size() + proj_sums_.size() + 
+                  proj_rhoV_coeffs_.size())*sizeof(double);
+   }
+
+   void Finalize(const WaveSeries &series) override
+   {
+      // Attempt to collapse groups onto their unique projections, if there
+      // is a single direction or at least two waves per direction on 
+      // average
+      collapsed_ = false;
+      const std::size_t num_pts = series.num_pts;
+      const int num_groups = series.num_groups;
+      if (collapsing_ && series.coords && series.num_waves > 0 && 
+            (num_groups == 1 || 2*num_groups <= series.num_waves))
+      {
+         proj_offsets_.assign(1, 0);
+         projs_.clear();
+         pt_proj_idxs_.resize(num_groups*num_pts);
+
+         const double full_cost = double(series.num_waves)*num_pts;
+         double collapsed_cost = 0.0;
+         std::vector<double> proj(num_pts);
+         std::unordered_map<double, std::size_t> proj_idxs;
+         for (int g = 0; g < num_groups && collapsed_cost <= 0.5*full_cost;
+               g++)
+         {
+            Project(series.dim, num_pts, series.coords, 
+                     series.group_k_hats + g*series.dim, proj.data());
+            proj_idxs.clear();
+            for (std::size_t i = 0; i < num_pts; i++)
+            {
+               const std::size_t idx = proj_idxs.size();
+               const auto [it, inserted] = proj_idxs.try_emplace(proj[i], 
+                                                                  idx);
+               if (inserted)
+               {
+                  projs_.push_back(proj[i]);
+               }
+               pt_proj_idxs_[g*num_pts + i] = it->second;
+            }
+            proj_offsets_.push_back(projs_.size());
+
+            const int num_group_waves = series.group_offsets[g+1] - 
+                                          series.group_offsets[g];
+            collapsed_cost += double(num_group_waves)*proj_idxs.size();
+         }
+         collapsed_ = collapsed_cost <= 0.5*full_cost;
+      }
+
+      if (!collapsed_)
+      {
+         proj_offsets_ = {};
+         projs_ = {};
+         pt_proj_idxs_ = {};
+         proj_sums_ = {};
+         proj_rhoV_coeffs_ = {};
+         inner_->Finalize(series);
+         return;
+      }
+
+      proj_sums_.resize(2*projs_.size());
+      proj_rhoV_coeffs_.resize(series.num_waves);
+      const double c_bar = std::sqrt(series.gamma*series.p_bar/
+                                       series.rho_bar);
+      for (int w = 0; w < series.num_waves; w++)
+      {
+         const int speed_encoder = (series.wave_speeds[w] == 'S' ? -1 : 1);
+         proj_rhoV_coeffs_[w] = speed_encoder*series.wave_amps[w]/
+                                    (series.rho_bar*c_bar);
+      }
+   }
+
+   void Prepare(const WaveSeries &series, const double t) override
+   {
+      if (!collapsed_)
+      {
+         inner_->Prepare(series, t);
+      }
+   }
+
+   void Advance(const WaveSeries &series, const double dt) override
+   {
+      if (!collapsed_)
+      {
+         inner_->Advance(series, dt);
+      }
+   }
+
+   void Compute(const WaveSeries &series, const double t, double *rho,
+                  double *rhoV, double *rhoE) override
+   {
+      if (!collapsed_)
+      {
+         inner_->Compute(series, t, rho, rhoV, rhoE);
+         return;
+      }
+      DispatchDim(series.dim, [&](const auto dim)
+      {
+         ComputeCollapsedKernel<decltype(dim)::value>(series.num_pts, 
+                              series.rho_bar, series.p_bar, series.U_bar,
+                              series.gamma, series.num_groups,
+                              series.group_offsets, series.group_k_hats,
+                              proj_offsets_.data(), projs_.data(),
+                              pt_proj_idxs_.data(), t, series.rho_coeffs,
+                              proj_rhoV_coeffs_.data(), series.wave_omegas,
+                              series.wave_k_mags, series.wave_phases, 
+                              proj_sums_.data(), rho, rhoV, rhoE, accuracy_,
+                              fields_, variables_);
+      });
+   }
+
+   void ComputeBatch(const WaveSeries &series, const std::size_t num_times,
+                     const double *times, double *rho, double *rhoV,
+                     double *rhoE) override
+   {
+      if (!collapsed_)
+      {
+         inner_->ComputeBatch(series, num_times, times, rho, rhoV, rhoE);
+         return;
+      }
+      ComputeEngine::ComputeBatch(series, num_times, times, rho, rhoV, rhoE);
+   }
+};
+
+/**
+ * @brief Engine of AcousticField::UsesRecurrence() and 
+ * AcousticField::UsesFFTSynthesis(), evaluating progressions of uniformly
+ * spaced frequencies sharing a direction and speed by FFT synthesis via 
+ * \ref ComputeSynthesisKernel() where enabled and cheaper for every 
+ * progression, or else by recurrence via \ref ComputeRecurrenceKernel() 
+ * where enabled. Otherwise, the wrapped engine is used.
+ */
+class ProgressionEngine : public ComputeEngine
+{
+private:
+
+   /// Engine used if the waves do not form progressions.
+   const std::unique_ptr<ComputeEngine> inner_;
+
+   /// Whether progressions may be evaluated by recurrence.
+   const bool use_recurrence_;
+
+   /// Whether progressions may be evaluated by FFT synthesis.
+   const bool use_synthesis_;
+
+   /// Relative tolerance of the FFT synthesis.
+   const double tolerance_;
+
+   /// Outputs to write.
+   const FieldMask fields_;
+
+   /// Form of the output variables.
+   const Variables variables_;
+
+   /// Path of the series, set in \ref Finalize().
+   EnginePath path_ = EnginePath::PerWave;
+
+   /**
+    * @brief Index of the first wave of each progression, with the waves 
+    * of each progression contiguous and ordered by frequency. Sized 
+    * number of progressions + 1.
+    */
+   std::vector<int> prog_offsets_;
+
+   /**
+    * @brief Direction of each progression, sized number of progressions x
+    * dimension with ordering [progression][dim].
+    */
+   std::vector<double> prog_k_hats_;
+
+   /**
+    * @brief Factors scaling wave amplitudes to the density, velocity, 
+    * and energy series coefficients of each progression, sized number of
+    * progressions x (dimension + 2) with ordering [progression][series].
+    */
+   std::vector<double> prog_factors_;
+
+   /**
+    * @brief First wavenumber and wavenumber spacing of each progression,
+    * sized number of progressions x 2.
+    */
+   std::vector<double> prog_ks_;
+
+   /**
+    * @brief First angular frequency and angular frequency spacing of each
+    * progression, sized number of progressions x 2.
+    */
+   std::vector<double> prog_omegas_;
+
+   /// Angular frequency of each wave, in progression order.
+   std::vector<double> omegas_;
+
+   /// \f$A\cos\phi\f$ of each wave, in progression order.
+   std::vector<double> amps_cos_phi_;
+
+   /// \f$A\sin\phi\f$ of each wave, in progression order.
+   std::vector<double> amps_sin_phi_;
+
+   /// FFT synthesis plan of each progression, if EnginePath::Synthesis.
+   std::vector<ProgressionFFTPlan> plans_;
+
+   /**
+    * @brief Order the waves of each group of \p series into progressions 
+    * by speed, setting \ref prog_offsets_ and returning the order. Empty
+    * if any are not progressions.
+    */
+   std::vector<int> OrderProgressions(const WaveSeries &series)
+   {
+      std::vector<int> order(series.num_waves);
+      std::iota(order.begin(), order.end(), 0);
+      prog_offsets_.assign(1, 0);
+      std::vector<double> omegas;
+      for (int g = 0; g < series.num_groups; g++)
+      {
+         const auto g_begin = order.begin() + series.group_offsets[g];
+         const auto g_end = order.begin() + series.group_offsets[g+1];
+         std::sort(g_begin, g_end, [&](const int a, const int b)
+                   { 
+                     return std::tie(series.wave_speeds[a], 
+                                       series.wave_omegas[a]) <
+                              std::tie(series.wave_speeds[b], 
+                                       series.wave_omegas[b]);
+                   });
+         for (auto it = g_begin; it != g_end;)
+         {
+            const char speed = series.wave_speeds[*it];
+            const auto run_end = std::find_if(it, g_end, [&](const int w)
+                                 { return series.wave_speeds[w] != speed; });
+            omegas.clear();
+            for (auto w_it = it; w_it != run_end; w_it++)
+            {
+               omegas.push_back(series.wave_omegas[*w_it]);
+            }
+            if (!IsProgression(omegas))
+            {
+               prog_offsets_ = {};
+               return {};
+            }
+            prog_offsets_.push_back(run_end - order.begin());
+            it = run_end;
+         }
+      }
+      return order;
+   }
+
+public:
+
+   ProgressionEngine(const AcousticField &field, 
+                     std::unique_ptr<ComputeEngine> inner)
+   : inner_(std::move(inner)),
+     use_recurrence_(field.Recurrence() && !field.MixedPrecision() &&
+                     field.CosineAccuracy() == Accuracy::Exact),
+     use_synthesis_(field.FFTSynthesis()),
+     tolerance_(field.NUFFTTolerance()),
+     fields_(field.OutputFields()),
+     variables_(field.OutputVariables())
+   { }
+
+   EngineCapabilities Capabilities() const override
+   {
+      if (path_ == EnginePath::PerWave)
+      {
+         return inner_->Capabilities();
+      }
+      EngineCapabilities caps;
+      caps.variables = true;
+      return caps;
+   }
+
+   EnginePath Path() const override
+   {
+      return (path_ == EnginePath::PerWave) ? inner_->Path() : path_;
+   }
+
+   std::size_t MemoryEstimate(const WaveSeries &series) const override
+   {
+      if (path_ == EnginePath::PerWave)
+      {
+         return inner_->MemoryEstimate(series);
+      }
+      std::size_t bytes = prog_offsets_.size()*sizeof(int) +
+                           (prog_k_hats_.size() + prog_factors_.size() + 
+                              prog_ks_.size() + prog_omegas_.size() + 
+                              omegas_.size() + amps_cos_phi_.size() + 
+                              amps_sin_phi_.size())*sizeof(double);
+      // Each plan holds an index, offset, and carrier per point
+      bytes += plans_.size()*series.num_pts*(sizeof(int) + sizeof(double) +
+                                       sizeof(std::complex<double>));
+      return bytes;
+   }
+
+   void Finalize(const WaveSeries &series) override
+   {
+      // Attempt to order the waves of each group into progressions of 
+      // uniformly spaced frequencies, by speed
+      path_ = EnginePath::PerWave;
+      plans_.clear();
+      std::vector<int> order;
+      if ((use_recurrence_ || use_synthesis_) && series.coords && 
+            series.num_waves >= kMinProgressionLength)
+      {
+         order = OrderProgressions(series);
+      }
+      if (order.empty())
+      {
+         inner_->Finalize(series);
+         return;
+      }
+
+      // Set the direction, series factors, and spacing of each progression
+      const int dim = series.dim;
+      const int num_progs = prog_offsets_.size() - 1;
+      const double c_bar = std::sqrt(series.gamma*series.p_bar/
+                                       series.rho_bar);
+      prog_k_hats_.resize(num_progs*dim);
+      prog_factors_.resize(num_progs*(dim + 2));
+      prog_ks_.resize(2*num_progs);
+      prog_omegas_.resize(2*num_progs);
+      omegas_.resize(series.num_waves);
+      amps_cos_phi_.resize(series.num_waves);
+      amps_sin_phi_.resize(series.num_waves);
+      for (int g = 0, p = 0; p < num_progs; p++)
+      {
+         const int first = prog_offsets_[p];
+         const int last = prog_offsets_[p+1] - 1;
+         while (series.group_offsets[g+1] <= first)
+         {
+            g++;
+         }
+         const int speed_encoder = (series.wave_speeds[order[first]] == 'S' ?
+                                       -1 : 1);
+
+         double *factors = prog_factors_.data() + p*(dim + 2);
+         factors[0] = 1.0/(c_bar*c_bar);
+         for (int d = 0; d < dim; d++)
+         {
+            const double k_hat = series.group_k_hats[g*dim + d];
+            prog_k_hats_[p*dim + d] = k_hat;
+            factors[1+d] = speed_encoder*k_hat/(series.rho_bar*c_bar);
+         }
+         factors[dim+1] = 1.0/(series.gamma - 1.0);
+
+         const double k_first = series.wave_k_mags[order[first]];
+         const double omega_first = series.wave_omegas[order[first]];
+         prog_ks_[2*p] = k_first;
+         prog_ks_[2*p+1] = (series.wave_k_mags[order[last]] - k_first)/
+                              (last - first);
+         prog_omegas_[2*p] = omega_first;
+         prog_omegas_[2*p+1] = (series.wave_omegas[order[last]] - 
+                                 omega_first)/(last - first);
+
+         for (int j = first; j <= last; j++)
+         {
+            const int w = order[j];
+            omegas_[j] = series.wave_omegas[w];
+            amps_cos_phi_[j] = series.wave_amps[w]*
+                                 std::cos(series.wave_phases[w]);
+            amps_sin_phi_[j] = series.wave_amps[w]*
+                                 std::sin(series.wave_phases[w]);
+         }
+      }
+
+      // Evaluate progressions by FFT synthesis to within the tolerance, if
+      // estimated to be cheaper than recurrence for each
+      if (use_synthesis_)
+      {
+         std::vector<double> proj(series.num_pts);
+         for (int p = 0; p < num_progs; p++)
+         {
+            Project(dim, series.num_pts, series.coords, 
+                     prog_k_hats_.data() + p*dim, proj.data());
+            plans_.emplace_back(series.num_pts, proj.data(), 
+                           prog_offsets_[p+1] - prog_offsets_[p],
+                           prog_ks_[2*p], prog_ks_[2*p+1], tolerance_);
+            if (!plans_.back().UsesFFT())
+            {
+               plans_.clear();
+               break;
+            }
+         }
+         if (!plans_.empty())
+         {
+            path_ = EnginePath::Synthesis;
+         }
+      }
+      if (path_ == EnginePath::PerWave && use_recurrence_)
+      {
+         path_ = EnginePath::Recurrence;
+      }
+
+      if (path_ == EnginePath::PerWave)
+      {
+         prog_offsets_ = {};
+         prog_k_hats_ = {};
+         prog_factors_ = {};
+         prog_ks_ = {};
+         prog_omegas_ = {};
+         omegas_ = {};
+         amps_cos_phi_ = {};
+         amps_sin_phi_ = {};
+         inner_->Finalize(series);
+      }
+   }
+
+   void Prepare(const WaveSeries &series, const double t) override
+   {
+      if (path_ == EnginePath::PerWave)
+      {
+         inner_->Prepare(series, t);
+      }
+   }
+
+   void Advance(const WaveSeries &series, const double dt) override
+   {
+      if (path_ == EnginePath::PerWave)
+      {
+         inner_->Advance(series, dt);
+      }
+   }
+
+   void Compute(const WaveSeries &series, const double t, double *rho,
+                  double *rhoV, double *rhoE) override
+   {
+      if (path_ == EnginePath::PerWave)
+      {
+         inner_->Compute(series, t, rho, rhoV, rhoE);
+         return;
+      }
+      const int num_progs = prog_offsets_.size() - 1;
+      DispatchDim(series.dim, [&](const auto dim)
+      {
+         constexpr std::size_t TDim = decltype(dim)::value;
+         if (path_ == EnginePath::Synthesis)
+         {
+            ComputeSynthesisKernel<TDim>(series.num_pts, series.rho_bar,
+                              series.p_bar, series.U_bar, series.gamma, 
+                              num_progs, prog_offsets_.data(),
+                              prog_factors_.data(), t, omegas_.data(),
+                              amps_cos_phi_.data(), amps_sin_phi_.data(),
+                              plans_.data(), rho, rhoV, rhoE, fields_, 
+                              variables_);
+         }
+         else
+         {
+            ComputeRecurrenceKernel<TDim>(series.num_pts, series.rho_bar,
+                              series.p_bar, series.U_bar, series.gamma, 
+                              num_progs, prog_offsets_.data(),
+                              prog_k_hats_.data(), prog_factors_.data(),
+                              prog_ks_.data(), prog_omegas_.data(), t,
+                              amps_cos_phi_.data(), amps_sin_phi_.data(),
+                              series.coords, rho, rhoV, rhoE, fields_, 
+                              variables_);
+         }
+      });
+   }
+
+   void ComputeBatch(const WaveSeries &series, const std::size_t num_times,
+                     const double *times, double *rho, double *rhoV,
+                     double *rhoE) override
+   {
+      if (path_ == EnginePath::PerWave)
+      {
+         inner_->ComputeBatch(series, num_times, times, rho, rhoV, rhoE);
+         return;
+      }
+      ComputeEngine::ComputeBatch(series, num_times, times, rho, rhoV, rhoE);
+   }
+};
+
+/**
+ * @brief Factory and capabilities of the built-in \p TEngine, for 
+ * \ref EngineRegistry.
+ */
+template<typename TEngine>
+std::pair<EngineRegistry::Factory, EngineCapabilities> BuiltinEntry()
+{
+   return {[](const AcousticField &field) -> std::unique_ptr<ComputeEngine>
+           { return std::make_unique<TEngine>(field); },
+           TEngine::StaticCapabilities()};
+}
+
+} // namespace
+
+void ComputeEngine::ComputeBatch(const WaveSeries &series,
+                                 const std::size_t num_times,
+                                 const double *times, double *rho,
+                                 double *rhoV, double *rhoE)
+{
+   const std::size_t num_pts = series.num_pts;
+   for (std::size_t t = 0; t < num_times; t++)
+   {
+      Prepare(series, times[t]);
+      Compute(series, times[t], rho + t*num_pts,
+               rhoV + t*series.dim*num_pts, rhoE + t*num_pts);
+   }
+}
+
+std::unique_ptr<ComputeEngine> WrapAutomaticPaths(const AcousticField &field,
+                                       std::unique_ptr<ComputeEngine> inner)
+{
+   // Collapsing is attempted first, as it also applies to progressions
+   inner = std::make_unique<ProgressionEngine>(field, std::move(inner));
+   return std::make_unique<CollapsedEngine>(field, std::move(inner));
+}
+
+std::vector<EngineRegistry::Entry>& EngineRegistry::Entries()
+{
+   static std::vector<Entry> entries = []()
+   {
+      const std::array<std::pair<Factory, EngineCapabilities>, 
+                        kBuiltinNames.size()> builtins =
+      {{
+         BuiltinEntry<PhaseEngine<true>>(),     // GridPoint
+         BuiltinEntry<PhaseEngine<false>>(),    // Wave
+         BuiltinEntry<PhasorEngine>(),          // Phasor
+         BuiltinEntry<OnTheFlyEngine>(),        // OnTheFly
+         BuiltinEntry<SIMDEngine>(),            // SIMD
+         BuiltinEntry<NUFFTEngine>(),           // NUFFT
+         BuiltinEntry<GEMMEngine>(),            // GEMM
+         BuiltinEntry<TileExpansionEngine>(),   // TileExpansion
+         BuiltinEntry<LowRankEngine>(),         // LowRank
+         BuiltinEntry<MultiRateEngine>(),       // MultiRate
+      }};
+      std::vector<Entry> entries;
+      for (std::size_t k = 0; k < kBuiltinNames.size(); k++)
+      {
+         entries.push_back({std::string(kBuiltinNames[k]), 
+                              builtins[k].first, builtins[k].second});
+      }
+      return entries;
+   }();
+   return entries;
+}
+
+const EngineRegistry::Entry& EngineRegistry::Find(std::string_view name)
+{
+   const auto it = std::ranges::find_if(Entries(), [&](const Entry &entry)
+                                        { return entry.name == name; });
+   if (it == Entries().end())
+   {
+      throw std::invalid_argument(std::format("Unknown compute engine: {}",
+                                                name));
+   }
+   return *it;
+}
+
+void EngineRegistry::Register(std::string name, Factory factory,
+                              EngineCapabilities caps)
+{
+   // Names are whitespace-delimited in the autotune cache
+   if (name.empty() || std::ranges::any_of(name, [](const char c)
+                                             { return std::isspace(
+                                             static_cast<unsigned char>(c)); }))
+   {
+      throw std::invalid_argument("Compute engine name must be non-empty "
+                                    "and contain no whitespace.");
+   }
+   if (!factory)
+   {
+      throw std::invalid_argument("Compute engine factory must be set.");
+   }
+   if (Contains(name))
+   {
+      throw std::invalid_argument(std::format("Compute engine already "
+                                                "registered: {}", name));
+   }
+   Entries().push_back({std::move(name), std::move(factory), caps});
+}
+
+void EngineRegistry::Unregister(std::string_view name)
+{
+   if (std::ranges::find(kBuiltinNames, name) != kBuiltinNames.end())
+   {
+      throw std::invalid_argument(std::format("Cannot unregister built-in "
+                                                "compute engine: {}", name));
+   }
+   const auto it = std::ranges::find_if(Entries(), [&](const Entry &entry)
+                                        { return entry.name == name; });
+   if (it == Entries().end())
+   {
+      throw std::invalid_argument(std::format("Unknown compute engine: {}",
+                                                name));
+   }
+   Entries().erase(it);
+}
+
+bool EngineRegistry::Contains(std::string_view name)
+{
+   return std::ranges::any_of(Entries(), [&](const Entry &entry)
+                              { return entry.name == name; });
+}
+
+std::vector<std::string> EngineRegistry::Names()
+{
+   std::vector<std::string> names;
+   for (const Entry &entry : Entries())
+   {
+      names.push_back(entry.name);
+   }
+   return names;
+}
+
+std::unique_ptr<ComputeEngine> EngineRegistry::Create(std::string_view name,
+                                                const AcousticField &field)
+{
+   return Find(name).factory(field);
+}
+
+EngineCapabilities EngineRegistry::Capabilities(std::string_view name)
+{
+   return Find(name).caps;
+}
+
+} // namespace jabber
@@ -0,0 +1,364 @@
+#ifndef JABBER_ENGINE
+#define JABBER_ENGINE
+
+#include "kernels.hpp"
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <cstddef>
+#include <cstdint>
+
+namespace jabber
+{
+
+class AcousticField;
+struct StructuredGrid;
+
+/**
+ * @defgroup engine_group Compute Engines
+ * @{
+ *
+ */
+
+/**
+ * @brief Base flow, points, and per-wave series coefficients of an
+ * AcousticField, prepared in AcousticField::Finalize() and passed to its
+ * ComputeEngine.
+ *
+ * @details All arrays are owned by the AcousticField, and are valid until
+ * it is finalized again or destroyed. Waves are ordered contiguously by
+ * direction group.
+ */
+struct WaveSeries
+{
+   /// Spatial dimension.
+   int dim;
+
+   /// Number of points.
+   std::size_t num_pts;
+
+   /// Base flow density.
+   double rho_bar;
+
+   /// Base flow pressure.
+   double p_bar;
+
+   /// Base flow velocity vector, sized \ref dim.
+   const double *U_bar;
+
+   /// Base flow specific heat ratio, γ.
+   double gamma;
+
+   /// Number of waves.
+   int num_waves;
+
+   /// Density series coefficients, sized \ref num_waves.
+   const double *rho_coeffs;
+
+   /// Momentum series coefficients, sized \ref dim x \ref num_waves.
+   const double *rhoV_coeffs;
+
+   /// Energy series coefficients, sized \ref num_waves.
+   const double *rhoE_coeffs;
+
+   /// Angular frequencies, sized \ref num_waves.
+   const double *wave_omegas;
+
+   /// Wavenumber vectors, sized \ref dim x \ref num_waves.
+   const double *wave_ks;
+
+   /// Phases, sized \ref num_waves.
+   const double *wave_phases;
+
+   /// Wavenumber magnitudes along each direction, sized \ref num_waves.
+   const double *wave_k_mags;
+
+   /// Pressure amplitudes, sized \ref num_waves.
+   const double *wave_amps;
+
+   /// Speed of each wave, 'F' (fast) or 'S' (slow), sized \ref num_waves.
+   const char *wave_speeds;
+
+   /// Number of groups of waves sharing a direction.
+   int num_groups;
+
+   /// Index of the first wave of each group, sized \ref num_groups + 1.
+   const int *group_offsets;
+
+   /// Direction of each group, sized \ref num_groups x \ref dim.
+   const double *group_k_hats;
+
+   /**
+    * @brief Point coordinates, sized \ref dim x \ref num_pts with ordering
+    * [dim][point]. Null if \ref grid is set.
+    */
+   const double *coords;
+
+   /// Structured grid of the points, or null if unstructured.
+   const StructuredGrid *grid;
+};
+
+/// Properties of a ComputeEngine used by AcousticField.
+struct EngineCapabilities
+{
+   /// Whether structured fields are supported, in addition to unstructured.
+   bool structured = false;
+
+   /**
+    * @brief Whether ComputeEngine::Advance() is cheaper than
+    * ComputeEngine::Prepare(), such that it is used in
+    * AcousticField::Advance().
+    */
+   bool advances = false;
+
+   /// Whether the engine depends on AcousticField::TileSize().
+   bool tiled = false;
+
+   /**
+    * @brief Whether ComputeEngine::Compute() outputs 
+    * AcousticField::OutputVariables() directly. Otherwise, the 
+    * conservative variables are output and converted by AcousticField.
+    */
+   bool variables = false;
+
+   /**
+    * @brief Bitmask of the supported spatial dimensions, with bit 
+    * \f$d-1\f$ set if dimension \f$d\f$ is supported.
+    */
+   unsigned dims = 0b111;
+
+   /**
+    * @brief Whether the engine is a candidate of AcousticField::Kernel::Auto.
+    * Only set if the field is evaluated exactly, rather than to within a
+    * tolerance, for every supported dimension.
+    */
+   bool autotuned = false;
+
+   /// Check if dimension \p dim is supported.
+   bool SupportsDim(int dim) const
+   {
+      return dim >= 1 && dim <= 3 && ((dims >> (dim - 1)) & 1u);
+   }
+};
+
+/// Path by which a ComputeEngine evaluates the series of a field.
+enum class EnginePath : std::uint8_t
+{
+   /// Each wave is evaluated in turn, as in the engine's kernel.
+   PerWave,
+
+   /**
+    * @brief Few waves are evaluated with the wave loop unrolled, via
+    * \ref ComputeUnrolledKernel() (see AcousticField::IsUnrolled()).
+    */
+   Unrolled,
+
+   /**
+    * @brief Groups of waves sharing a direction are evaluated once per 
+    * unique projection of the points, via \ref ComputeCollapsedKernel()
+    * (see AcousticField::IsCollapsed()).
+    */
+   Collapsed,
+
+   /**
+    * @brief Progressions of uniformly spaced frequencies are evaluated by
+    * recurrence, via \ref ComputeRecurrenceKernel() (see 
+    * AcousticField::UsesRecurrence()).
+    */
+   Recurrence,
+
+   /**
+    * @brief Progressions are evaluated by FFT synthesis, via
+    * \ref ComputeSynthesisKernel() (see AcousticField::UsesFFTSynthesis()).
+    */
+   Synthesis
+};
+
+/**
+ * @brief Interface of the evaluation of the series of an AcousticField.
+ *
+ * @details An engine is created by EngineRegistry for each call to
+ * AcousticField::Finalize(), with any settings read from the field then,
+ * and wrapped by \ref WrapAutomaticPaths(). It is then called as follows:
+ *
+ *    1. \ref Finalize(), once, to precompute any per-point data,
+ *    2. \ref Prepare() for each exact evaluation at a time \f$t\f$, or
+ *       \ref Advance() from the previous time if \ref
+ *       EngineCapabilities::advances, and
+ *    3. \ref Compute() at that time.
+ *
+ * Each call is passed the same WaveSeries, which the engine may not
+ * retain pointers into between calls.
+ */
+class ComputeEngine
+{
+public:
+
+   virtual ~ComputeEngine() = default;
+
+   /// Get the capabilities of the engine.
+   virtual EngineCapabilities Capabilities() const = 0;
+
+   /**
+    * @brief Get the path by which the series is evaluated, as decided in
+    * \ref Finalize().
+    */
+   virtual EnginePath Path() const { return EnginePath::PerWave; }
+
+   /**
+    * @brief Get an estimate of the number of bytes allocated by
+    * \ref Finalize() for \p series.
+    */
+   virtual std::size_t MemoryEstimate(const WaveSeries &series) const = 0;
+
+   /// Precompute any per-point data of \p series.
+   virtual void Finalize(const WaveSeries &series) = 0;
+
+   /// Evaluate any time-dependent data of \p series at time \p t exactly.
+   virtual void Prepare([[maybe_unused]] const WaveSeries &series,
+                        [[maybe_unused]] double t) { }
+
+   /**
+    * @brief Advance any time-dependent data of \p series by \p dt from the
+    * previous time. Only called if \ref EngineCapabilities::advances.
+    */
+   virtual void Advance([[maybe_unused]] const WaveSeries &series,
+                        [[maybe_unused]] double dt) { }
+
+   /**
+    * @brief Compute the conservative variables of \p series at time \p t,
+    * after \ref Prepare() or \ref Advance() to \p t, or 
+    * AcousticField::OutputVariables() if \ref EngineCapabilities::variables.
+    *
+    * @param series     Series of the field.
+    * @param t          Time to compute at.
+    * @param rho        Output density, sized by number of points.
+    * @param rhoV       Output momentum, sized by dimension x number of
+    *                   points with ordering [dim][point].
+    * @param rhoE       Output energy, sized by number of points.
+    */
+   virtual void Compute(const WaveSeries &series, double t, double *rho,
+                        double *rhoV, double *rhoE) = 0;
+
+   /**
+    * @brief Compute the conservative variables of \p series at each of
+    * \p num_times \p times, as in AcousticField::ComputeBatch().
+    *
+    * @details By default, this calls \ref Prepare() and \ref Compute() for
+    * each time.
+    */
+   virtual void ComputeBatch(const WaveSeries &series, std::size_t num_times,
+                              const double *times, double *rho,
+                              double *rhoV, double *rhoE);
+};
+
+/**
+ * @brief Registry of the ComputeEngine implementations available to
+ * AcousticField, by name.
+ *
+ * @details The built-in engines, one per AcousticField::Kernel (other than
+ * AcousticField::Kernel::Auto and AcousticField::Kernel::Custom), are 
+ * registered under \ref kBuiltinNames. Further engines may be registered via
+ * \ref Register() and selected by AcousticField::SetEngine(). These are
+ * only candidates of AcousticField::Kernel::Auto if they set
+ * EngineCapabilities::autotuned. The capabilities of each engine are 
+ * registered with its factory, such that they are queried by 
+ * \ref Capabilities() without creating an engine. Registration is not 
+ * thread-safe.
+ */
+class EngineRegistry
+{
+public:
+
+   /// Factory of an engine, reading any settings from the field.
+   using Factory =
+      std::function<std::unique_ptr<ComputeEngine>(const AcousticField&)>;
+
+   /// Names of the built-in engines, ordered as AcousticField::Kernel.
+   static constexpr std::array<std::string_view, 10> kBuiltinNames =
+   {
+      "GridPoint",      // AcousticField::Kernel::GridPoint
+      "Wave",           // AcousticField::Kernel::Wave
+      "Phasor",         // AcousticField::Kernel::Phasor
+      "OnTheFly",       // AcousticField::Kernel::OnTheFly
+      "SIMD",           // AcousticField::Kernel::SIMD
+      "NUFFT",          // AcousticField::Kernel::NUFFT
+      "GEMM",           // AcousticField::Kernel::GEMM
+      "TileExpansion",  // AcousticField::Kernel::TileExpansion
+      "LowRank",        // AcousticField::Kernel::LowRank
+      "MultiRate",      // AcousticField::Kernel::MultiRate
+   };
+
+   /**
+    * @brief Register \p factory under \p name, which must not be registered
+    * already, with \p caps the ComputeEngine::Capabilities() of the 
+    * engines it creates.
+    */
+   static void Register(std::string name, Factory factory, 
+                        EngineCapabilities caps);
+
+   /**
+    * @brief Unregister the engine registered under \p name, which must not
+    * be built-in.
+    */
+   static void Unregister(std::string_view name);
+
+   /// Check if an engine is registered under \p name.
+   static bool Contains(std::string_view name);
+
+   /// Get the names of all engines, in order of registration.
+   static std::vector<std::string> Names();
+
+   /// Create the engine registered under \p name, for \p field.
+   static std::unique_ptr<ComputeEngine> Create(std::string_view name,
+                                                const AcousticField &field);
+
+   /// Get the capabilities registered under \p name.
+   static EngineCapabilities Capabilities(std::string_view name);
+
+private:
+
+   /// Registered engine.
+   struct Entry
+   {
+      /// Name, as selected by AcousticField::SetEngine().
+      std::string name;
+
+      /// Factory of the engine.
+      Factory factory;
+
+      /// Capabilities of the engines created by \ref factory.
+      EngineCapabilities caps;
+   };
+
+   /// All registered engines, starting with the built-ins.
+   static std::vector<Entry>& Entries();
+
+   /// Get the entry registered under \p name.
+   static const Entry& Find(std::string_view name);
+};
+
+/**
+ * @brief Wrap \p inner in the engines of the automatic paths of \p field 
+ * (EnginePath::Collapsed, EnginePath::Recurrence, and 
+ * EnginePath::Synthesis), as enabled by its settings.
+ * 
+ * @details In ComputeEngine::Finalize(), each wrapper checks whether its
+ * path applies to the series, and otherwise forwards every call to the
+ * engine it wraps, including ComputeEngine::Capabilities() and
+ * ComputeEngine::Path(). While a path applies, the wrapped engine is not
+ * finalized, and the capabilities are those of the path.
+ */
+std::unique_ptr<ComputeEngine> WrapAutomaticPaths(const AcousticField &field,
+                                       std::unique_ptr<ComputeEngine> inner);
+
+/// @}
+// end of engine_group
+
+} // namespace jabber
+
+#endif // JABBER_ENGINE
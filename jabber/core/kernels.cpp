@@ -1,231 +1,3528 @@
 #include "kernels.hpp"
+#include "kernels_simd.hpp"
 
 #include <cmath>
+#include <array>
+#include <vector>
+#include <utility>
+#include <complex>
+#include <algorithm>
+#include <stdexcept>
+
+#ifdef JABBER_WITH_OPENMP
+#include <omp.h>
+#endif // JABBER_WITH_OPENMP
 
 namespace jabber
 {
 
-template<std::size_t TDim, bool TGridInnerLoop>
-void ComputeKernel(const std::size_t num_pts, const double rho_bar,
+namespace
+{
+
+/**
+ * @brief Initialize the density perturbation in \p rho to zero and the 
+ * velocity in \p rhoV to \p U_bar, prior to adding the contribution of 
+ * each wave.
+ * 
+ * @details \p rhoV is only initialized if \p TVelocity, with components
+ * spaced by \p stride.
+ */
+template<std::size_t TDim, bool TVelocity>
+void InitPerturbation(const std::size_t num_pts, const std::size_t stride,
+                        const double *U_bar,
+                        double *__restrict__ rho,
+                        double *__restrict__ rhoV)
+{
+   for (std::size_t i = 0; i < num_pts; i++)
+   {
+      rho[i] = 0.0;
+
+      if constexpr (TVelocity)
+      {
+         rhoV[i] = U_bar[0];
+         if constexpr(TDim > 1)
+         {
+            rhoV[stride + i] = U_bar[1];
+         }
+         if constexpr(TDim > 2)
+         {
+            rhoV[2*stride + i] = U_bar[2];
+         }
+      }
+   }
+}
+
+/**
+ * @brief Check if the velocity must be summed for the outputs \p fields,
+ * as it is needed for both the momentum and the kinetic energy.
+ */
+constexpr bool NeedsVelocity(const FieldMask fields)
+{
+   return HasField(fields, Field::Momentum) || HasField(fields, Field::Energy);
+}
+
+/**
+ * @brief Call \p func with a `std::integral_constant` of \p fields, such
+ * that each nonzero FieldMask is specialized at compile time.
+ */
+template<typename TFunc>
+void DispatchFields(const FieldMask fields, TFunc &&func)
+{
+   if (fields == 0 || fields > kAllFields)
+   {
+      throw std::logic_error("Invalid field mask!");
+   }
+   [&]<std::size_t... Masks>(const std::index_sequence<Masks...>&)
+   {
+      ([&]()
+       {
+         if (fields == Masks + 1)
+         {
+            func(std::integral_constant<FieldMask, Masks + 1>{});
+         }
+       }(), ...);
+   }(std::make_index_sequence<kAllFields>{});
+}
+
+/**
+ * @brief Store \p val to \p dest, bypassing the cache if \p TNonTemporal
+ * and supported by the compiler.
+ */
+template<bool TNonTemporal>
+inline void Store(double *dest, const double val)
+{
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_nontemporal_store)
+   if constexpr (TNonTemporal)
+   {
+      __builtin_nontemporal_store(val, dest);
+      return;
+   }
+#endif
+#endif
+   *dest = val;
+}
+
+/**
+ * @brief Minimax coefficients of \f$\cos(a)\f$ as a polynomial in 
+ * \f$a^2\f$ on \f$[0,\pi/2]\f$, in increasing order, with absolute 
+ * error 7.5e-13.
+ */
+constexpr double kCosCoeffsHigh[] = {9.99999999999251821e-01,
+                                    -4.99999999970240305e-01,
+                                     4.16666664733851971e-02,
+                                    -1.38888841800116234e-03,
+                                     2.48010406487959089e-05,
+                                    -2.75246963897447423e-07,
+                                     1.99078568518033863e-09};
+
+/// Equivalent of \ref kCosCoeffsHigh, with absolute error 4.7e-8.
+constexpr double kCosCoeffsLow[] = {9.99999953466670144e-01,
+                                   -4.99999053470767396e-01,
+                                    4.16635846931080675e-02,
+                                   -1.38537043082335391e-03,
+                                    2.31539316590890385e-05};
+
+/// Evaluate the polynomial with coefficients \p coeffs at \p x (Horner).
+template<std::size_t N>
+inline double Polynomial(const double (&coeffs)[N], const double x)
+{
+   double p = coeffs[N-1];
+   for (std::size_t j = N-1; j-- > 0;)
+   {
+      p = p*x + coeffs[j];
+   }
+   return p;
+}
+
+/**
+ * @brief Evaluate \f$\cos(x)\f$ to within \p TAccuracy.
+ * 
+ * @details For reduced accuracies, \p x is first reduced to 
+ * \f$r\in[-\pi,\pi]\f$ using a two-part \f$2\pi\f$ (Cody & Waite), 
+ * exact for \f$|x| < 2^{29}\pi\f$. Then \f$|r|\f$ is reflected onto
+ * \f$a\in[0,\pi/2]\f$ via \f$\cos(r)=-\cos(\pi-|r|)\f$, where the 
+ * minimax polynomial is evaluated. All steps are branch-free, so that 
+ * this vectorizes within the kernel inner loops.
+ */
+template<Accuracy TAccuracy>
+inline double Cos(const double x)
+{
+   if constexpr (TAccuracy == Accuracy::Exact)
+   {
+      return std::cos(x);
+   }
+   else
+   {
+      // 2π = k2PiHi + k2PiLo, with k2PiHi having 24 significant bits
+      constexpr double k2PiHi = 6.2831854820251465;
+      constexpr double k2PiLo = -1.748455600074497e-07;
+      constexpr double kInv2Pi = 1.0/(2.0*M_PI);
+
+      // Round to nearest integer, valid for magnitudes below 2^51
+      constexpr double kRound = 6755399441055744.0;
+
+      const double n = (x*kInv2Pi + kRound) - kRound;
+      const double r = (x - n*k2PiHi) - n*k2PiLo;
+
+      const double abs_r = std::abs(r);
+      const bool reflect = abs_r > 0.5*M_PI;
+      const double a = reflect ? M_PI - abs_r : abs_r;
+      const double a2 = a*a;
+
+      const double p = (TAccuracy == Accuracy::High) ? 
+                              Polynomial(kCosCoeffsHigh, a2) : 
+                              Polynomial(kCosCoeffsLow, a2);
+      return reflect ? -p : p;
+   }
+}
+
+/**
+ * @brief Base flow quantities needed to assemble the output Variables from
+ * the summed perturbations.
+ */
+struct BaseState
+{
+   /// Base flow density.
+   double rho;
+
+   /// Base flow velocity, sized by dimension.
+   const double *U;
+
+   /// Base flow energy \f$\bar{p}/(\gamma-1)\f$.
+   double rhoE;
+
+   /// \f$\gamma-1\f$.
+   double gamma_m1;
+
+   /// \f$\frac{1}{2}|\bar{\vec{U}}|^2\f$.
+   double half_mag_U;
+};
+
+/// Get the BaseState of the given base flow.
+template<std::size_t TDim>
+BaseState MakeBaseState(const double rho_bar, const double p_bar, 
+                        const double *U_bar, const double gamma)
+{
+   double mag_U = 0.0;
+   for (std::size_t d = 0; d < TDim; d++)
+   {
+      mag_U += U_bar[d]*U_bar[d];
+   }
+   return {rho_bar, U_bar, p_bar/(gamma-1.0), gamma-1.0, 0.5*mag_U};
+}
+
+/**
+ * @brief Call \p func with a `std::integral_constant` of \p variables, 
+ * such that each is specialized at compile time.
+ */
+template<typename TFunc>
+void DispatchVariables(const Variables variables, TFunc &&func)
+{
+   switch (variables)
+   {
+      case Variables::Conservative:
+         func(std::integral_constant<Variables, Variables::Conservative>{});
+         break;
+      case Variables::Primitive:
+         func(std::integral_constant<Variables, Variables::Primitive>{});
+         break;
+      case Variables::Linearized:
+         func(std::integral_constant<Variables, Variables::Linearized>{});
+         break;
+      default:
+         throw std::logic_error("Unimplemented variables!");
+   }
+}
+
+/**
+ * @brief Store the outputs in \p TFields of a single point as 
+ * \p TVariables, given its summed density perturbation \p rho_p, internal
+ * energy perturbation \p rhoE_p, and velocity \p u.
+ * 
+ * @details \p u includes the base flow velocity only for 
+ * Variables::Conservative, and is only read if the momentum or energy is 
+ * stored. \p rho, \p rhoV, and \p rhoE are offset to the point, with 
+ * components of \p rhoV spaced by \p stride.
+ */
+template<std::size_t TDim, FieldMask TFields, Variables TVariables, 
+         bool TNonTemporal>
+inline void StoreOutputs(const BaseState &base, const double rho_p, 
+                           const double rhoE_p, const double *u,
+                           const std::size_t stride,
+                           double *__restrict__ rho,
+                           double *__restrict__ rhoV,
+                           double *__restrict__ rhoE)
+{
+   constexpr bool kMomentum = HasField(TFields, Field::Momentum);
+   constexpr std::size_t kVelDim = NeedsVelocity(TFields) ? TDim : 0;
+
+   if constexpr (TVariables == Variables::Conservative)
+   {
+      const double rho_i = base.rho + rho_p;
+      double mag_u = 0.0;
+      for (std::size_t d = 0; d < kVelDim; d++)
+      {
+         mag_u += u[d]*u[d];
+         if constexpr (kMomentum)
+         {
+            Store<TNonTemporal>(rhoV + d*stride, rho_i*u[d]);
+         }
+      }
+      if constexpr (HasField(TFields, Field::Density))
+      {
+         Store<TNonTemporal>(rho, rho_i);
+      }
+      if constexpr (HasField(TFields, Field::Energy))
+      {
+         Store<TNonTemporal>(rhoE, base.rhoE + rhoE_p + 0.5*rho_i*mag_u);
+      }
+   }
+   else if constexpr (TVariables == Variables::Primitive)
+   {
+      if constexpr (kMomentum)
+      {
+         for (std::size_t d = 0; d < TDim; d++)
+         {
+            Store<TNonTemporal>(rhoV + d*stride, u[d]);
+         }
+      }
+      if constexpr (HasField(TFields, Field::Density))
+      {
+         Store<TNonTemporal>(rho, rho_p);
+      }
+      if constexpr (HasField(TFields, Field::Energy))
+      {
+         Store<TNonTemporal>(rhoE, base.gamma_m1*rhoE_p);
+      }
+   }
+   else
+   {
+      double U_dot_u = 0.0;
+      for (std::size_t d = 0; d < kVelDim; d++)
+      {
+         U_dot_u += base.U[d]*u[d];
+         if constexpr (kMomentum)
+         {
+            Store<TNonTemporal>(rhoV + d*stride, 
+                                 base.rho*u[d] + rho_p*base.U[d]);
+         }
+      }
+      if constexpr (HasField(TFields, Field::Density))
+      {
+         Store<TNonTemporal>(rho, rho_p);
+      }
+      if constexpr (HasField(TFields, Field::Energy))
+      {
+         Store<TNonTemporal>(rhoE, rhoE_p + base.rho*U_dot_u + 
+                                    base.half_mag_U*rho_p);
+      }
+   }
+}
+
+/**
+ * @brief Store a tile of summed density perturbation and velocity, from
+ * which the density and internal energy are derived, storing only the 
+ * outputs in \p TFields as \p TVariables.
+ * 
+ * @details The internal energy perturbation is \p rhoE_per_rho times the
+ * density perturbation in \p rho_t, as both are proportional to the 
+ * pressure perturbation. \p u_t is only read if the momentum or energy is
+ * stored.
+ */
+template<std::size_t TDim, FieldMask TFields, Variables TVariables, 
+         bool TNonTemporal>
+void StorePerturbed(const std::size_t num_pts, 
+                     const std::size_t tile_stride,
+                     const BaseState &base, const double rhoE_per_rho,
+                     const double *__restrict__ rho_t,
+                     const double *__restrict__ u_t,
+                     const std::size_t stride,
+                     double *__restrict__ rho,
+                     double *__restrict__ rhoV,
+                     double *__restrict__ rhoE)
+{
+   constexpr std::size_t kVelDim = NeedsVelocity(TFields) ? TDim : 0;
+   for (std::size_t i = 0; i < num_pts; i++)
+   {
+      double u[3];
+      for (std::size_t d = 0; d < kVelDim; d++)
+      {
+         u[d] = u_t[d*tile_stride + i];
+      }
+      StoreOutputs<TDim, TFields, TVariables, TNonTemporal>(base, rho_t[i],
+                                    rhoE_per_rho*rho_t[i], u, stride, 
+                                    rho + i, rhoV + i, rhoE + i);
+   }
+}
+
+/**
+ * @brief Add the contribution of waves [\p w_begin, \p w_end) to the
+ * accumulators of a single tile of \p num_pts points, with \p rho_t 
+ * accumulating the density perturbation only.
+ * 
+ * @details \p k_dot_x_p_phi is offset to the first point of the tile, and
+ * has ordering [wave][point] with a stride of \p stride between waves.
+ * Components of \p u_t are spaced by \p tile_stride. If not 
+ * \p TVelocity, neither \p u_t nor \p rhoV_coeffs is accessed.
+ */
+template<std::size_t TDim, Accuracy TAccuracy, bool TVelocity>
+void AccumulateTile(const std::size_t num_pts, const std::size_t tile_stride,
+                     const int w_begin, const int w_end, const int num_waves,
+                     const double t,
+                     const double *__restrict__ rho_coeffs,
+                     const double *__restrict__ rhoV_coeffs,
+                     const double *__restrict__ wave_omegas,
+                     const std::size_t stride,
+                     const double *__restrict__ k_dot_x_p_phi,
+                     double *__restrict__ rho_t,
+                     double *__restrict__ u_t)
+{
+   for (int w = w_begin; w < w_end; w++)
+   {
+      const double rho_coeff_w = rho_coeffs[w];
+      const double rhoV1_coeff_w = TVelocity ? rhoV_coeffs[w] : 0;
+      const double rhoV2_coeff_w = TVelocity && TDim > 1 ? 
+                                    rhoV_coeffs[num_waves + w] : 0;
+      const double rhoV3_coeff_w = TVelocity && TDim > 2 ? 
+                                    rhoV_coeffs[2*num_waves + w] : 0;
+      const double omt = wave_omegas[w]*t;
+
+      const double *__restrict__ k_dot_x_p_phi_w = k_dot_x_p_phi + w*stride;
+
+      for (std::size_t i = 0; i < num_pts; i++)
+      {
+         const double cos_w = Cos<TAccuracy>(k_dot_x_p_phi_w[i] - omt);
+
+         rho_t[i] += rho_coeff_w*cos_w;
+         if constexpr (TVelocity)
+         {
+            u_t[i] += rhoV1_coeff_w*cos_w;
+            if constexpr(TDim > 1)
+            {
+               u_t[tile_stride + i] += rhoV2_coeff_w*cos_w;
+            }
+            if constexpr(TDim > 2)
+            {
+               u_t[2*tile_stride + i] += rhoV3_coeff_w*cos_w;
+            }
+         }
+      }
+   }
+}
+
+/**
+ * @brief Call \ref StorePerturbed() for \p variables, with non-temporal 
+ * stores if \p nontemporal.
+ */
+template<std::size_t TDim, FieldMask TFields>
+inline void StorePerturbedTile(const bool nontemporal, 
+                              const Variables variables,
+                              const std::size_t num_pts,
+                              const std::size_t tile_stride,
+                              const BaseState &base, 
+                              const double rhoE_per_rho,
+                              const double *__restrict__ rho_t,
+                              const double *__restrict__ u_t,
+                              const std::size_t stride,
+                              double *__restrict__ rho,
+                              double *__restrict__ rhoV,
+                              double *__restrict__ rhoE)
+{
+   DispatchVariables(variables, [&](const auto vars)
+   {
+      constexpr Variables kVariables = decltype(vars)::value;
+      if (nontemporal)
+      {
+         StorePerturbed<TDim, TFields, kVariables, true>(num_pts, 
+                                    tile_stride, base, rhoE_per_rho, rho_t,
+                                    u_t, stride, rho, rhoV, rhoE);
+      }
+      else
+      {
+         StorePerturbed<TDim, TFields, kVariables, false>(num_pts, 
+                                    tile_stride, base, rhoE_per_rho, rho_t,
+                                    u_t, stride, rho, rhoV, rhoE);
+      }
+   });
+}
+
+/**
+ * @brief Call \ref StorePerturbedTile() for the outputs in \p fields.
+ */
+template<std::size_t TDim>
+inline void StoreFieldsTile(const FieldMask fields, const bool nontemporal,
+                              const Variables variables,
+                              const std::size_t num_pts,
+                              const std::size_t tile_stride,
+                              const BaseState &base, 
+                              const double rhoE_per_rho,
+                              const double *__restrict__ rho_t,
+                              const double *__restrict__ u_t,
+                              const std::size_t stride,
+                              double *__restrict__ rho,
+                              double *__restrict__ rhoV,
+                              double *__restrict__ rhoE)
+{
+   DispatchFields(fields, [&](const auto mask)
+   {
+      StorePerturbedTile<TDim, decltype(mask)::value>(nontemporal, variables,
+                                    num_pts, tile_stride, base, rhoE_per_rho,
+                                    rho_t, u_t, stride, rho, rhoV, rhoE);
+   });
+}
+
+/**
+ * @brief Equivalent of \ref StoreFieldsTile() for points scattered to 
+ * the indices \p pts of the outputs, without non-temporal stores.
+ */
+template<std::size_t TDim>
+void StoreFieldsScattered(const FieldMask fields, const Variables variables,
+                           const std::size_t num_pts,
+                           const std::size_t tile_stride,
+                           const std::size_t *__restrict__ pts,
+                           const BaseState &base, 
+                           const double rhoE_per_rho,
+                           const double *__restrict__ rho_t,
+                           const double *__restrict__ u_t,
+                           const std::size_t stride,
+                           double *__restrict__ rho,
+                           double *__restrict__ rhoV,
+                           double *__restrict__ rhoE)
+{
+   DispatchFields(fields, [&](const auto mask)
+   {
+      constexpr FieldMask kFields = decltype(mask)::value;
+      constexpr std::size_t kVelDim = NeedsVelocity(kFields) ? TDim : 0;
+      DispatchVariables(variables, [&](const auto vars)
+      {
+         for (std::size_t i = 0; i < num_pts; i++)
+         {
+            double u[3];
+            for (std::size_t d = 0; d < kVelDim; d++)
+            {
+               u[d] = u_t[d*tile_stride + i];
+            }
+            const std::size_t pt = pts[i];
+            StoreOutputs<TDim, kFields, decltype(vars)::value, false>(base,
+                                    rho_t[i], rhoE_per_rho*rho_t[i], u, 
+                                    stride, rho + pt, rhoV + pt, rhoE + pt);
+         }
+      });
+   });
+}
+
+/**
+ * @brief Get the number of blocks to split waves into, such that there are
+ * at least as many (point block, wave block) pairs as threads.
+ */
+inline int NumWaveBlocks([[maybe_unused]] const std::size_t num_pt_blocks, 
+                         [[maybe_unused]] const int num_waves)
+{
+#ifdef JABBER_WITH_OPENMP
+   const std::size_t num_threads = omp_get_max_threads();
+   if (num_pt_blocks >= num_threads || num_waves <= 1)
+   {
+      return 1;
+   }
+   return static_cast<int>(std::min<std::size_t>(num_waves, 
+                     (num_threads + num_pt_blocks - 1)/num_pt_blocks));
+#else
+   return 1;
+#endif // JABBER_WITH_OPENMP
+}
+
+/**
+ * @brief Get the number of blocks to split waves into for a deterministic
+ * evaluation, as a function of \p num_waves only.
+ */
+inline int NumDeterministicWaveBlocks(const int num_waves)
+{
+   return std::clamp(num_waves/kDeterministicBlockWaves, 1, 
+                     kMaxDeterministicWaveBlocks);
+}
+
+/**
+ * @brief Sum the \p num_partials partial sums of a tile, each sized 
+ * \p stride and stored contiguously, into the first by pairwise 
+ * combination in a fixed order.
+ */
+inline void CombinePartials(const int num_partials, const std::size_t stride,
+                              double *partials)
+{
+   for (int step = 1; step < num_partials; step *= 2)
+   {
+      for (int wb = 0; wb + step < num_partials; wb += 2*step)
+      {
+         double *__restrict__ dst = partials + wb*stride;
+         const double *__restrict__ src = partials + (wb + step)*stride;
+         for (std::size_t j = 0; j < stride; j++)
+         {
+            dst[j] += src[j];
+         }
+      }
+   }
+}
+
+/// Rows of the register tile in \ref GEMMMicroKernel().
+constexpr std::size_t kGEMMTileRows = 4;
+
+/// Columns (points) of the register tile in \ref GEMMMicroKernel().
+constexpr std::size_t kGEMMTileCols = 8;
+
+/**
+ * @brief Depth of each block of the inner dimension in 
+ * \ref ComputeGEMMKernel(), such that a packed column sliver of \f$B\f$
+ * fits within L1 cache.
+ */
+constexpr std::size_t kGEMMBlockDepth = 256;
+
+/**
+ * @brief Number of points per block in \ref ComputeGEMMKernel(), such
+ * that a packed block of \f$B\f$ fits within L2 cache.
+ */
+constexpr std::size_t kGEMMBlockPts = 128;
+
+/**
+ * @brief Add the product of packed row sliver \p a and packed column 
+ * sliver \p b, each of depth \p depth, to the \ref kGEMMTileRows x 
+ * \ref kGEMMTileCols tile of \p c with row stride \p ldc.
+ * 
+ * @details The tile is accumulated in registers over the full depth, 
+ * with \p a ordered [depth][row] and \p b ordered [depth][col].
+ */
+inline void GEMMMicroKernel(const std::size_t depth, 
+                              const double *__restrict__ a,
+                              const double *__restrict__ b,
+                              double *__restrict__ c, const std::size_t ldc)
+{
+   double acc[kGEMMTileRows][kGEMMTileCols] = {};
+   for (std::size_t k = 0; k < depth; k++)
+   {
+      const double *a_k = a + k*kGEMMTileRows;
+      const double *b_k = b + k*kGEMMTileCols;
+      for (std::size_t r = 0; r < kGEMMTileRows; r++)
+      {
+         for (std::size_t j = 0; j < kGEMMTileCols; j++)
+         {
+            acc[r][j] += a_k[r]*b_k[j];
+         }
+      }
+   }
+   for (std::size_t r = 0; r < kGEMMTileRows; r++)
+   {
+      for (std::size_t j = 0; j < kGEMMTileCols; j++)
+      {
+         c[r*ldc + j] += acc[r][j];
+      }
+   }
+}
+
+/**
+ * @brief Implementation of \ref ComputeKernel(), with the cosine evaluated
+ * to within \p TAccuracy and only the outputs in \p TFields written as 
+ * \p variables.
+ */
+template<std::size_t TDim, bool TGridInnerLoop, Accuracy TAccuracy, 
+         FieldMask TFields>
+void ComputeKernelImpl(const std::size_t num_pts, const double rho_bar,
                         const double p_bar, const double *U_bar, 
                         const double gamma, const int num_waves,
                         const double t,
                         const double *__restrict__ rho_coeffs,
                         const double *__restrict__ rhoV_coeffs,
-                        const double *__restrict__ rhoE_coeffs, 
                         const double *__restrict__ wave_omegas,
                         const double *__restrict__ k_dot_x_p_phi,
                         double *__restrict__ rho,
                         double *__restrict__ rhoV,
-                        double *__restrict__ rhoE)
+                        double *__restrict__ rhoE,
+                        const std::size_t tile_size,
+                        const bool deterministic,
+                        const Variables variables)
 {
-   const double rhoE_init = p_bar/(gamma-1.0);
+   const BaseState base = MakeBaseState<TDim>(rho_bar, p_bar, U_bar, gamma);
+
+   // Ratio c²/(γ-1) of the internal energy and density perturbations
+   const double rhoE_per_rho = gamma*p_bar/(rho_bar*(gamma-1.0));
+
+   constexpr bool kVelocity = NeedsVelocity(TFields);
+   constexpr std::size_t kVelDim = kVelocity ? TDim : 0;
+
+   // Base flow velocity summed with the perturbation, if conservative
+   const double zeros[3] = {0.0, 0.0, 0.0};
+   const double *u_init = (variables == Variables::Conservative) ? 
+                              U_bar : zeros;
+
+   if constexpr (TGridInnerLoop)
+   {
+      const std::size_t num_tiles = (num_pts + tile_size - 1)/tile_size;
+      const int num_thread_blocks = NumWaveBlocks(num_tiles, num_waves);
+      const int num_wave_blocks = deterministic ? 
+                                    NumDeterministicWaveBlocks(num_waves) :
+                                    num_thread_blocks;
+
+      // Only bypass the cache for outputs that would not fit in it anyways
+      constexpr std::size_t kNumOutputs = 
+               HasField(TFields, Field::Density) + 
+               (HasField(TFields, Field::Momentum) ? TDim : 0) +
+               HasField(TFields, Field::Energy);
+      const bool nontemporal = 
+               kNumOutputs*num_pts*sizeof(double) > kNonTemporalStoreBytes;
+
+      // Size of accumulators for a single tile, with ordering [rho'][u]
+      // and rho', u each sized tile_size (u omitted if unneeded)
+      const std::size_t tile_stride = (1+kVelDim)*tile_size;
+
+      // Accumulate the waves of a wave block into the partial sums of a 
+      // tile, with only the first wave block including any base flow 
+      // velocity
+      const auto AccumulateBlock = [&](const std::size_t b, const int wb,
+                                       double *__restrict__ rho_t, 
+                                       double *__restrict__ u_t)
+      {
+         const std::size_t begin = b*tile_size;
+         const std::size_t n = std::min(tile_size, num_pts - begin);
+         const int w_begin = wb*num_waves/num_wave_blocks;
+         const int w_end = (wb+1)*num_waves/num_wave_blocks;
+
+         InitPerturbation<TDim, kVelocity>(n, tile_size, 
+                                    wb == 0 ? u_init : zeros, rho_t, u_t);
+
+         AccumulateTile<TDim, TAccuracy, kVelocity>(n, tile_size, w_begin, 
+                              w_end, num_waves, t, rho_coeffs, rhoV_coeffs,
+                              wave_omegas, num_pts, k_dot_x_p_phi + begin,
+                              rho_t, u_t);
+      };
+
+      // Write out the summed partials of a tile
+      const auto StoreTile = [&](const std::size_t b, 
+                                 const double *__restrict__ tile)
+      {
+         const std::size_t begin = b*tile_size;
+         const std::size_t n = std::min(tile_size, num_pts - begin);
+         StorePerturbedTile<TDim, TFields>(nontemporal, variables, n, 
+                                 tile_size, base, rhoE_per_rho, tile, 
+                                 tile + tile_size, num_pts, rho + begin, 
+                                 rhoV + begin, rhoE + begin);
+      };
+
+      if (num_thread_blocks == 1)
+      {
+         // Each thread sums all wave blocks for its tiles
+#ifdef JABBER_WITH_OPENMP
+         #pragma omp parallel
+#endif // JABBER_WITH_OPENMP
+         {
+            std::vector<double> tile(num_wave_blocks*tile_stride);
+
+#ifdef JABBER_WITH_OPENMP
+            #pragma omp for
+#endif // JABBER_WITH_OPENMP
+            for (std::size_t b = 0; b < num_tiles; b++)
+            {
+               for (int wb = 0; wb < num_wave_blocks; wb++)
+               {
+                  double *__restrict__ rho_t = tile.data() + wb*tile_stride;
+                  AccumulateBlock(b, wb, rho_t, rho_t + tile_size);
+               }
+               CombinePartials(num_wave_blocks, tile_stride, tile.data());
+               StoreTile(b, tile.data());
+            }
+         }
+      }
+      else
+      {
+         // Too few tiles to occupy all threads, so each (tile, wave block)
+         // pair is summed independently, with partials ordered 
+         // [tile][wave block]
+         std::vector<double> partials(num_tiles*num_wave_blocks*tile_stride);
+
+#ifdef JABBER_WITH_OPENMP
+         #pragma omp parallel for collapse(2)
+#endif // JABBER_WITH_OPENMP
+         for (std::size_t b = 0; b < num_tiles; b++)
+         {
+            for (int wb = 0; wb < num_wave_blocks; wb++)
+            {
+               double *__restrict__ rho_t = partials.data() + 
+                                       (b*num_wave_blocks + wb)*tile_stride;
+               AccumulateBlock(b, wb, rho_t, rho_t + tile_size);
+            }
+         }
+
+         // Sum partials of each tile in a fixed order + write out
+#ifdef JABBER_WITH_OPENMP
+         #pragma omp parallel for
+#endif // JABBER_WITH_OPENMP
+         for (std::size_t b = 0; b < num_tiles; b++)
+         {
+            double *tile = partials.data() + b*num_wave_blocks*tile_stride;
+            CombinePartials(num_wave_blocks, tile_stride, tile);
+            StoreTile(b, tile);
+         }
+      }
+   }
+   else
+   {
+      DispatchVariables(variables, [&](const auto vars)
+      {
+         constexpr Variables kVariables = decltype(vars)::value;
+
+#ifdef JABBER_WITH_OPENMP
+         #pragma omp parallel for
+#endif // JABBER_WITH_OPENMP
+         for (std::size_t i = 0; i < num_pts; i++)
+         {
+            double rho_p_i = 0.0;
+            double u_i[3] = {u_init[0], TDim > 1 ? u_init[1] : 0.0, 
+                              TDim > 2 ? u_init[2] : 0.0};
+
+            const std::size_t i_offset = i*num_waves;
+            
+            for (int w = 0; w < num_waves; w++)
+            {
+               const double omt = wave_omegas[w]*t;
+               const double cos_w = Cos<TAccuracy>(
+                                       k_dot_x_p_phi[i_offset + w] - omt);
+
+               rho_p_i += rho_coeffs[w]*cos_w;
+               for (std::size_t d = 0; d < kVelDim; d++)
+               {
+                  u_i[d] += rhoV_coeffs[d*num_waves + w]*cos_w;
+               }
+            }
+
+            // Assemble outputs directly, as only the requested outputs 
+            // are written
+            StoreOutputs<TDim, TFields, kVariables, false>(base, rho_p_i, 
+                                    rhoE_per_rho*rho_p_i, u_i, num_pts, 
+                                    rho + i, rhoV + i, rhoE + i);
+         }
+      });
+   }
+}
+
+/**
+ * @brief Number of points per tile in \ref ComputeRecurrenceKernel(), 
+ * such that the per-point phasors and accumulators of a tile fit within 
+ * L1 cache.
+ */
+constexpr std::size_t kRecurrenceTileSize = 256;
+
+/**
+ * @brief Implementation of \ref ComputeRecurrenceKernel(), with only the 
+ * outputs in \p TFields written as \p variables.
+ */
+template<std::size_t TDim, FieldMask TFields>
+void ComputeRecurrenceKernelImpl(const std::size_t num_pts, 
+                        const double rho_bar, const double p_bar, 
+                        const double *U_bar, const double gamma, 
+                        const int num_progs,
+                        const int *__restrict__ prog_offsets,
+                        const double *__restrict__ prog_k_hats,
+                        const double *__restrict__ prog_factors,
+                        const double *__restrict__ prog_ks,
+                        const double *__restrict__ prog_omegas,
+                        const double t,
+                        const double *__restrict__ amps_cos_phi,
+                        const double *__restrict__ amps_sin_phi,
+                        const double *__restrict__ coords,
+                        double *__restrict__ rho,
+                        double *__restrict__ rhoV,
+                        double *__restrict__ rhoE,
+                        const Variables variables)
+{
+   constexpr std::size_t kTile = kRecurrenceTileSize;
+   constexpr std::size_t kNumSeries = TDim + 2;
+   constexpr std::size_t kVelDim = NeedsVelocity(TFields) ? TDim : 0;
+   constexpr bool kEnergy = HasField(TFields, Field::Energy);
+   const BaseState base = MakeBaseState<TDim>(rho_bar, p_bar, U_bar, gamma);
+
+   // Base flow velocity added to the perturbation, if conservative
+   const double zeros[3] = {0.0, 0.0, 0.0};
+   const double *u_init = (variables == Variables::Conservative) ? 
+                              U_bar : zeros;
+
+   const std::size_t num_tiles = (num_pts + kTile - 1)/kTile;
+
+#ifdef JABBER_WITH_OPENMP
+   #pragma omp parallel
+#endif // JABBER_WITH_OPENMP
+   {
+      // Per-point phasors e^{iα}, z=e^{iβ}, Horner accumulator, and sums
+      std::vector<double> work(6*kTile + kNumSeries*kTile);
+      double *__restrict__ cos_a = work.data();
+      double *__restrict__ sin_a = cos_a + kTile;
+      double *__restrict__ cos_b = sin_a + kTile;
+      double *__restrict__ sin_b = cos_b + kTile;
+      double *__restrict__ acc_re = sin_b + kTile;
+      double *__restrict__ acc_im = acc_re + kTile;
+      double *__restrict__ sums = acc_im + kTile;
+
+#ifdef JABBER_WITH_OPENMP
+      #pragma omp for
+#endif // JABBER_WITH_OPENMP
+      for (std::size_t b = 0; b < num_tiles; b++)
+      {
+         const std::size_t begin = b*kTile;
+         const std::size_t n = std::min(kTile, num_pts - begin);
+         std::fill(sums, sums + kNumSeries*kTile, 0.0);
+
+         for (int p = 0; p < num_progs; p++)
+         {
+            const double *k_hat = prog_k_hats + p*TDim;
+            const double k0 = prog_ks[2*p], dk = prog_ks[2*p+1];
+            const double omt0 = prog_omegas[2*p]*t;
+            const double domt = prog_omegas[2*p+1]*t;
+            for (std::size_t i = 0; i < n; i++)
+            {
+               double s = 0.0;
+               for (std::size_t d = 0; d < TDim; d++)
+               {
+                  s += k_hat[d]*coords[d*num_pts + begin + i];
+               }
+               const double alpha = k0*s - omt0;
+               const double beta = dk*s - domt;
+               cos_a[i] = std::cos(alpha);
+               sin_a[i] = std::sin(alpha);
+               cos_b[i] = std::cos(beta);
+               sin_b[i] = std::sin(beta);
+               acc_re[i] = 0.0;
+               acc_im[i] = 0.0;
+            }
+
+            // Horner's rule over waves: acc = acc*z + A_j e^{iφ_j}
+            for (int w = prog_offsets[p+1] - 1; w >= prog_offsets[p]; w--)
+            {
+               const double c_re = amps_cos_phi[w];
+               const double c_im = amps_sin_phi[w];
+               for (std::size_t i = 0; i < n; i++)
+               {
+                  const double re = acc_re[i]*cos_b[i] - acc_im[i]*sin_b[i];
+                  const double im = acc_re[i]*sin_b[i] + acc_im[i]*cos_b[i];
+                  acc_re[i] = re + c_re;
+                  acc_im[i] = im + c_im;
+               }
+            }
+
+            // Re(e^{iα}acc), scaled to each series needed
+            const double *factors = prog_factors + p*kNumSeries;
+            for (std::size_t i = 0; i < n; i++)
+            {
+               const double val = cos_a[i]*acc_re[i] - sin_a[i]*acc_im[i];
+               sums[i] += factors[0]*val;
+               for (std::size_t q = 1; q <= kVelDim; q++)
+               {
+                  sums[q*kTile + i] += factors[q]*val;
+               }
+               if constexpr (kEnergy)
+               {
+                  sums[(1+TDim)*kTile + i] += factors[1+TDim]*val;
+               }
+            }
+         }
+
+         // Assemble outputs, adding any base flow
+         DispatchVariables(variables, [&](const auto vars)
+         {
+            constexpr Variables kVariables = decltype(vars)::value;
+            for (std::size_t i = 0; i < n; i++)
+            {
+               double u[3];
+               for (std::size_t d = 0; d < kVelDim; d++)
+               {
+                  u[d] = u_init[d] + sums[(1+d)*kTile + i];
+               }
+               StoreOutputs<TDim, TFields, kVariables, false>(base, sums[i],
+                                    sums[(1+TDim)*kTile + i], u, num_pts, 
+                                    rho + begin + i, rhoV + begin + i, 
+                                    rhoE + begin + i);
+            }
+         });
+      }
+   }
+}
+
+/**
+ * @brief Number of points of a tile processed at once in 
+ * \ref ComputeExpansionKernel(), such that the per-point accumulators fit
+ * within L1 cache.
+ */
+constexpr std::size_t kExpansionChunkSize = 256;
+
+/**
+ * @brief Taylor coefficients \f$(-1)^m/(2m+\f$ \p TOdd \f$)!\f$ of 
+ * \f$\cos\psi\f$ (\p TOdd 0) or \f$\sin(\psi)/\psi\f$ (\p TOdd 1) in 
+ * \f$\psi^2\f$, up to order \p TOrder in \f$\psi\f$.
+ */
+template<int TOrder, int TOdd>
+constexpr auto TaylorCoeffs()
+{
+   constexpr int kNumCoeffs = (TOrder >= TOdd ? (TOrder - TOdd)/2 + 1 : 0);
+   std::array<double, kNumCoeffs> coeffs{};
+   double fact = 1.0;
+   for (int n = 1; n <= TOrder; n++)
+   {
+      fact *= n;
+      if (n % 2 == TOdd)
+      {
+         coeffs[n/2] = ((n/2) % 2 == 0 ? 1.0 : -1.0)/fact;
+      }
+   }
+   if constexpr (TOdd == 0 && kNumCoeffs > 0)
+   {
+      coeffs[0] = 1.0;
+   }
+   return coeffs;
+}
+
+/**
+ * @brief Accumulate all waves into a chunk of \p n points of a tile in 
+ * \ref ComputeExpansionKernel(), with \f$\cos\psi\f$ and 
+ * \f$\sin\psi\f$ expanded to order \p TOrder, or evaluated exactly if
+ * \p TOrder is -1.
+ * 
+ * @details Each component of \p deltas is spaced by \p stride. \p u_t is
+ * spaced by \ref kExpansionChunkSize, and only accumulated if 
+ * \p velocity.
+ */
+template<std::size_t TDim, int TOrder>
+void AccumulateExpansion(const std::size_t n, const std::size_t num_waves,
+                           const double *__restrict__ rho_coeffs,
+                           const double *__restrict__ rhoV_coeffs,
+                           const double *__restrict__ wave_ks,
+                           const double *__restrict__ cos_c,
+                           const double *__restrict__ sin_c,
+                           const std::size_t stride,
+                           const double *__restrict__ deltas,
+                           const bool velocity,
+                           double *__restrict__ rho_t,
+                           double *__restrict__ u_t)
+{
+   constexpr std::size_t kChunk = kExpansionChunkSize;
+   constexpr auto kCoeffsC = TaylorCoeffs<TOrder, 0>();
+   constexpr auto kCoeffsS = TaylorCoeffs<TOrder, 1>();
+
+   for (std::size_t w = 0; w < num_waves; w++)
+   {
+      double k[TDim];
+      for (std::size_t d = 0; d < TDim; d++)
+      {
+         k[d] = wave_ks[d*num_waves + w];
+      }
+      const double cos_w = cos_c[w], sin_w = sin_c[w];
+      const double rho_c = rho_coeffs[w];
+      double rhoV_c[TDim];
+      for (std::size_t d = 0; d < TDim; d++)
+      {
+         rhoV_c[d] = rhoV_coeffs[d*num_waves + w];
+      }
+
+      for (std::size_t i = 0; i < n; i++)
+      {
+         double psi = 0.0;
+         for (std::size_t d = 0; d < TDim; d++)
+         {
+            psi += k[d]*deltas[d*stride + i];
+         }
+
+         double exp_c, exp_s;
+         if constexpr (TOrder < 0)
+         {
+            exp_c = std::cos(psi);
+            exp_s = std::sin(psi);
+         }
+         else
+         {
+            // Horner's rule in ψ²
+            const double psi2 = psi*psi;
+            exp_c = kCoeffsC.back();
+            for (int m = int(kCoeffsC.size()) - 2; m >= 0; m--)
+            {
+               exp_c = exp_c*psi2 + kCoeffsC[m];
+            }
+            exp_s = 0.0;
+            if constexpr (kCoeffsS.size() > 0)
+            {
+               exp_s = kCoeffsS.back();
+               for (int m = int(kCoeffsS.size()) - 2; m >= 0; m--)
+               {
+                  exp_s = exp_s*psi2 + kCoeffsS[m];
+               }
+               exp_s *= psi;
+            }
+         }
+
+         // cos(θ_c+ψ), accumulated into each series
+         const double val = cos_w*exp_c - sin_w*exp_s;
+         rho_t[i] += rho_c*val;
+         if (velocity)
+         {
+            for (std::size_t d = 0; d < TDim; d++)
+            {
+               u_t[d*kChunk + i] += rhoV_c[d]*val;
+            }
+         }
+      }
+   }
+}
+
+/**
+ * @brief Number of points per tile in kernels summing each point in 
+ * registers (e.g. \ref ComputeUnrolledKernel()), whose sums are held until
+ * the outputs of the tile are written.
+ */
+constexpr std::size_t kSumTileSize = 256;
+
+/**
+ * @brief Implementation of \ref ComputeUnrolledKernel() for 
+ * \p TNumWaves waves, with the wave loop unrolled by a fold expression.
+ */
+template<std::size_t TDim, int TNumWaves, Accuracy TAccuracy>
+void ComputeUnrolledKernelImpl(const std::size_t num_pts, 
+                              const double rho_bar, const double p_bar, 
+                              const double *U_bar, const double gamma,
+                              const double t,
+                              const double *__restrict__ rho_coeffs,
+                              const double *__restrict__ rhoV_coeffs,
+                              const double *__restrict__ wave_omegas,
+                              const double *__restrict__ wave_ks,
+                              const double *__restrict__ wave_phases,
+                              const double *__restrict__ coords,
+                              double *__restrict__ rho,
+                              double *__restrict__ rhoV,
+                              double *__restrict__ rhoE,
+                              const FieldMask fields,
+                              const Variables variables)
+{
+   constexpr std::size_t kNumWaves = TNumWaves;
+   const BaseState base = MakeBaseState<TDim>(rho_bar, p_bar, U_bar, gamma);
+   const double rhoE_per_rho = gamma*p_bar/(rho_bar*(gamma-1.0));
+   const bool velocity = NeedsVelocity(fields);
+
+   // Copy all per-wave constants to locals, with time phases φ - ωt
+   double rho_c[kNumWaves], phase_c[kNumWaves];
+   double rhoV_c[TDim][kNumWaves], k_c[TDim][kNumWaves];
+   for (std::size_t w = 0; w < kNumWaves; w++)
+   {
+      rho_c[w] = rho_coeffs[w];
+      phase_c[w] = wave_phases[w] - wave_omegas[w]*t;
+      for (std::size_t d = 0; d < TDim; d++)
+      {
+         rhoV_c[d][w] = rhoV_coeffs[d*kNumWaves + w];
+         k_c[d][w] = wave_ks[d*kNumWaves + w];
+      }
+   }
+
+   // Base flow velocity summed with the perturbation, if conservative
+   double u_init[TDim];
+   for (std::size_t d = 0; d < TDim; d++)
+   {
+      u_init[d] = (variables == Variables::Conservative) ? U_bar[d] : 0.0;
+   }
+
+   const std::size_t num_tiles = (num_pts + kSumTileSize - 1)/
+                                    kSumTileSize;
+
+#ifdef JABBER_WITH_OPENMP
+   #pragma omp parallel for
+#endif // JABBER_WITH_OPENMP
+   for (std::size_t b = 0; b < num_tiles; b++)
+   {
+      const std::size_t begin = b*kSumTileSize;
+      const std::size_t n = std::min(kSumTileSize, num_pts - begin);
+
+      double rho_t[kSumTileSize];
+      double u_t[TDim*kSumTileSize];
+      for (std::size_t i = 0; i < n; i++)
+      {
+         double x_i[TDim];
+         for (std::size_t d = 0; d < TDim; d++)
+         {
+            x_i[d] = coords[d*num_pts + begin + i];
+         }
+
+         double rho_i = 0.0;
+         double u_i[TDim];
+         for (std::size_t d = 0; d < TDim; d++)
+         {
+            u_i[d] = u_init[d];
+         }
+
+         [&]<std::size_t... Ws>(const std::index_sequence<Ws...>&)
+         {
+            ([&]()
+             {
+               double theta = phase_c[Ws];
+               for (std::size_t d = 0; d < TDim; d++)
+               {
+                  theta += k_c[d][Ws]*x_i[d];
+               }
+               const double cos_w = Cos<TAccuracy>(theta);
+
+               rho_i += rho_c[Ws]*cos_w;
+               if (velocity)
+               {
+                  for (std::size_t d = 0; d < TDim; d++)
+                  {
+                     u_i[d] += rhoV_c[d][Ws]*cos_w;
+                  }
+               }
+             }(), ...);
+         }(std::make_index_sequence<kNumWaves>{});
+
+         rho_t[i] = rho_i;
+         for (std::size_t d = 0; d < TDim; d++)
+         {
+            u_t[d*kSumTileSize + i] = u_i[d];
+         }
+      }
+
+      // Write each output of the tile once
+      StoreFieldsTile<TDim>(fields, false, variables, n, kSumTileSize,
+                              base, rhoE_per_rho, rho_t, u_t, num_pts, 
+                              rho + begin, rhoV + begin, rhoE + begin);
+   }
+}
+
+/**
+ * @brief Implementation of \ref ComputeCollapsedKernel() for cosine 
+ * accuracy \p TAccuracy.
+ */
+template<std::size_t TDim, Accuracy TAccuracy>
+void ComputeCollapsedKernelImpl(const std::size_t num_pts, 
+                              const double rho_bar, const double p_bar, 
+                              const double *U_bar, const double gamma, 
+                              const int num_groups,
+                              const int *__restrict__ group_offsets,
+                              const double *__restrict__ group_k_hats,
+                              const std::size_t *__restrict__ proj_offsets,
+                              const double *__restrict__ projs,
+                              const std::size_t *__restrict__ pt_proj_idxs,
+                              const double t,
+                              const double *__restrict__ rho_coeffs,
+                              const double *__restrict__ rhoV_coeffs,
+                              const double *__restrict__ wave_omegas,
+                              const double *__restrict__ wave_k_mags,
+                              const double *__restrict__ wave_phases,
+                              double *__restrict__ proj_sums,
+                              double *__restrict__ rho,
+                              double *__restrict__ rhoV,
+                              double *__restrict__ rhoE,
+                              const FieldMask fields,
+                              const Variables variables)
+{
+   const BaseState base = MakeBaseState<TDim>(rho_bar, p_bar, U_bar, gamma);
+   const double rhoE_per_rho = gamma*p_bar/(rho_bar*(gamma-1.0));
+   const bool velocity = NeedsVelocity(fields);
+   const std::size_t num_projs = proj_offsets[num_groups];
+   double *rho_sums = proj_sums;
+   double *u_sums = proj_sums + num_projs;
+
+   // Base flow velocity summed with the perturbation, if conservative
+   double u_init[TDim];
+   for (std::size_t d = 0; d < TDim; d++)
+   {
+      u_init[d] = (variables == Variables::Conservative) ? U_bar[d] : 0.0;
+   }
+
+   const std::size_t num_tiles = (num_pts + kSumTileSize - 1)/kSumTileSize;
+
+#ifdef JABBER_WITH_OPENMP
+   #pragma omp parallel
+#endif // JABBER_WITH_OPENMP
+   {
+      // Sum each group's waves at each of its unique projections
+      for (int g = 0; g < num_groups; g++)
+      {
+#ifdef JABBER_WITH_OPENMP
+         #pragma omp for
+#endif // JABBER_WITH_OPENMP
+         for (std::size_t p = proj_offsets[g]; p < proj_offsets[g+1]; p++)
+         {
+            const double s = projs[p];
+            double rho_p = 0.0, u_p = 0.0;
+            for (int w = group_offsets[g]; w < group_offsets[g+1]; w++)
+            {
+               const double k_dot_x_p_phi = wave_k_mags[w]*s + wave_phases[w];
+               const double cos_w = Cos<TAccuracy>(k_dot_x_p_phi - 
+                                                   wave_omegas[w]*t);
+               rho_p += rho_coeffs[w]*cos_w;
+               if (velocity)
+               {
+                  u_p += rhoV_coeffs[w]*cos_w;
+               }
+            }
+            rho_sums[p] = rho_p;
+            u_sums[p] = u_p;
+         }
+      }
+
+      // Gather group sums to each point of a tile + write its outputs
+#ifdef JABBER_WITH_OPENMP
+      #pragma omp for
+#endif // JABBER_WITH_OPENMP
+      for (std::size_t b = 0; b < num_tiles; b++)
+      {
+         const std::size_t begin = b*kSumTileSize;
+         const std::size_t n = std::min(kSumTileSize, num_pts - begin);
+
+         double rho_t[kSumTileSize];
+         double u_t[TDim*kSumTileSize];
+         for (std::size_t i = 0; i < n; i++)
+         {
+            double rho_i = 0.0;
+            double u_i[TDim];
+            for (std::size_t d = 0; d < TDim; d++)
+            {
+               u_i[d] = u_init[d];
+            }
+            for (int g = 0; g < num_groups; g++)
+            {
+               const std::size_t p = proj_offsets[g] + 
+                                       pt_proj_idxs[g*num_pts + begin + i];
+               rho_i += rho_sums[p];
+               if (velocity)
+               {
+                  for (std::size_t d = 0; d < TDim; d++)
+                  {
+                     u_i[d] += group_k_hats[g*TDim + d]*u_sums[p];
+                  }
+               }
+            }
+
+            rho_t[i] = rho_i;
+            for (std::size_t d = 0; d < TDim; d++)
+            {
+               u_t[d*kSumTileSize + i] = u_i[d];
+            }
+         }
+
+         StoreFieldsTile<TDim>(fields, false, variables, n, kSumTileSize,
+                                 base, rhoE_per_rho, rho_t, u_t, num_pts, 
+                                 rho + begin, rhoV + begin, rhoE + begin);
+      }
+   }
+}
+
+/**
+ * @brief Dispatch \ref ComputeUnrolledKernel() to the specialization for
+ * \p num_waves waves.
+ */
+template<std::size_t TDim, Accuracy TAccuracy>
+void ComputeUnrolledKernelImpl(const std::size_t num_pts, 
+                              const double rho_bar, const double p_bar, 
+                              const double *U_bar, const double gamma,
+                              const int num_waves, const double t,
+                              const double *__restrict__ rho_coeffs,
+                              const double *__restrict__ rhoV_coeffs,
+                              const double *__restrict__ wave_omegas,
+                              const double *__restrict__ wave_ks,
+                              const double *__restrict__ wave_phases,
+                              const double *__restrict__ coords,
+                              double *__restrict__ rho,
+                              double *__restrict__ rhoV,
+                              double *__restrict__ rhoE,
+                              const FieldMask fields,
+                              const Variables variables)
+{
+   if (num_waves < 1 || num_waves > kMaxUnrolledWaves)
+   {
+      throw std::logic_error("Number of waves not unrolled!");
+   }
+   [&]<int... TNumWaves>(const std::integer_sequence<int, TNumWaves...>&)
+   {
+      ([&]()
+       {
+         if (num_waves == TNumWaves + 1)
+         {
+            ComputeUnrolledKernelImpl<TDim, TNumWaves + 1, TAccuracy>(
+                                 num_pts, rho_bar, p_bar, U_bar, gamma, t,
+                                 rho_coeffs, rhoV_coeffs, wave_omegas, 
+                                 wave_ks, wave_phases, coords, rho, rhoV, 
+                                 rhoE, fields, variables);
+         }
+       }(), ...);
+   }(std::make_integer_sequence<int, kMaxUnrolledWaves>{});
+}
+
+} // namespace
+
+template<std::size_t TDim, bool TGridInnerLoop>
+void ComputeKernel(const std::size_t num_pts, const double rho_bar,
+                        const double p_bar, const double *U_bar, 
+                        const double gamma, const int num_waves,
+                        const double t,
+                        const double *__restrict__ rho_coeffs,
+                        const double *__restrict__ rhoV_coeffs,
+                        const double *__restrict__ wave_omegas,
+                        const double *__restrict__ k_dot_x_p_phi,
+                        double *__restrict__ rho,
+                        double *__restrict__ rhoV,
+                        double *__restrict__ rhoE,
+                        const std::size_t tile_size,
+                        const Accuracy accuracy,
+                        const bool deterministic,
+                        const FieldMask fields,
+                        const Variables variables)
+{
+   switch (accuracy)
+   {
+      case Accuracy::Exact:
+         DispatchFields(fields, [&](const auto mask)
+         {
+            ComputeKernelImpl<TDim, TGridInnerLoop, Accuracy::Exact, 
+                              decltype(mask)::value>(num_pts, rho_bar, 
+                              p_bar, U_bar, gamma, num_waves, t, 
+                              rho_coeffs, rhoV_coeffs, wave_omegas,
+                              k_dot_x_p_phi, rho, rhoV, rhoE, tile_size,
+                              deterministic, variables);
+         });
+         break;
+      case Accuracy::High:
+         DispatchFields(fields, [&](const auto mask)
+         {
+            ComputeKernelImpl<TDim, TGridInnerLoop, Accuracy::High, 
+                              decltype(mask)::value>(num_pts, rho_bar, 
+                              p_bar, U_bar, gamma, num_waves, t, 
+                              rho_coeffs, rhoV_coeffs, wave_omegas,
+                              k_dot_x_p_phi, rho, rhoV, rhoE, tile_size,
+                              deterministic, variables);
+         });
+         break;
+      case Accuracy::Low:
+         DispatchFields(fields, [&](const auto mask)
+         {
+            ComputeKernelImpl<TDim, TGridInnerLoop, Accuracy::Low, 
+                              decltype(mask)::value>(num_pts, rho_bar, 
+                              p_bar, U_bar, gamma, num_waves, t, 
+                              rho_coeffs, rhoV_coeffs, wave_omegas,
+                              k_dot_x_p_phi, rho, rhoV, rhoE, tile_size,
+                              deterministic, variables);
+         });
+         break;
+      default:
+         throw std::logic_error("Unimplemented accuracy!");
+   }
+}
+
+template<std::size_t TDim>
+void ComputeMixedKernel(const std::size_t num_pts, const double rho_bar,
+                        const double p_bar, const double *U_bar, 
+                        const double gamma, const int num_waves,
+                        const double t,
+                        const double *__restrict__ rho_coeffs,
+                        const double *__restrict__ rhoV_coeffs,
+                        const double *__restrict__ wave_omegas,
+                        const float *__restrict__ k_dot_x_p_phi,
+                        double *__restrict__ rho,
+                        double *__restrict__ rhoV,
+                        double *__restrict__ rhoE,
+                        const std::size_t tile_size,
+                        const FieldMask fields,
+                        const Variables variables)
+{
+   const BaseState base = MakeBaseState<TDim>(rho_bar, p_bar, U_bar, gamma);
+   const double rhoE_per_rho = gamma*p_bar/(rho_bar*(gamma-1.0));
+
+   // Base flow velocity summed with the perturbation, if conservative
+   const double zeros[3] = {0.0, 0.0, 0.0};
+   const double *u_init = (variables == Variables::Conservative) ? 
+                              U_bar : zeros;
+
+   const bool velocity = NeedsVelocity(fields);
+   const std::size_t num_tiles = (num_pts + tile_size - 1)/tile_size;
+
+   // Reduce ωt to [-π,π] in double precision, and round with coefficients
+   std::vector<float> omts(num_waves);
+   std::vector<float> coeffs((1+TDim)*num_waves);
+   for (int w = 0; w < num_waves; w++)
+   {
+      omts[w] = static_cast<float>(std::remainder(wave_omegas[w]*t, 
+                                                   2.0*M_PI));
+      coeffs[w] = static_cast<float>(rho_coeffs[w]);
+      for (std::size_t d = 0; d < TDim; d++)
+      {
+         coeffs[(1+d)*num_waves + w] = 
+                           static_cast<float>(rhoV_coeffs[d*num_waves + w]);
+      }
+   }
+
+#ifdef JABBER_WITH_OPENMP
+   #pragma omp parallel
+#endif // JABBER_WITH_OPENMP
+   {
+      // Perturbation accumulators for a single tile, ordered [rho][u], and
+      // their sums with the base flow in double precision
+      std::vector<float> tile((1+TDim)*tile_size);
+      float *__restrict__ rho_t = tile.data();
+      float *__restrict__ u_t = rho_t + tile_size;
+      std::vector<double> sums((1+TDim)*tile_size);
+      double *__restrict__ rho_s = sums.data();
+      double *__restrict__ u_s = rho_s + tile_size;
+
+#ifdef JABBER_WITH_OPENMP
+      #pragma omp for
+#endif // JABBER_WITH_OPENMP
+      for (std::size_t b = 0; b < num_tiles; b++)
+      {
+         const std::size_t begin = b*tile_size;
+         const std::size_t n = std::min(tile_size, num_pts - begin);
+         std::fill(tile.begin(), tile.end(), 0.0f);
+
+         for (int w = 0; w < num_waves; w++)
+         {
+            const float rho_coeff_w = coeffs[w];
+            const float rhoV1_coeff_w = coeffs[num_waves + w];
+            const float rhoV2_coeff_w = TDim > 1 ? coeffs[2*num_waves + w] 
+                                                 : 0.0f;
+            const float rhoV3_coeff_w = TDim > 2 ? coeffs[3*num_waves + w] 
+                                                 : 0.0f;
+            const float omt = omts[w];
+
+            const float *__restrict__ k_dot_x_p_phi_w = 
+                                    k_dot_x_p_phi + w*num_pts + begin;
+
+            for (std::size_t i = 0; i < n; i++)
+            {
+               const float cos_w = std::cos(k_dot_x_p_phi_w[i] - omt);
+
+               rho_t[i] += rho_coeff_w*cos_w;
+               if (velocity)
+               {
+                  u_t[i] += rhoV1_coeff_w*cos_w;
+                  if constexpr(TDim > 1)
+                  {
+                     u_t[tile_size + i] += rhoV2_coeff_w*cos_w;
+                  }
+                  if constexpr(TDim > 2)
+                  {
+                     u_t[2*tile_size + i] += rhoV3_coeff_w*cos_w;
+                  }
+               }
+            }
+         }
+
+         // Add base flow velocity in double precision
+         for (std::size_t i = 0; i < n; i++)
+         {
+            rho_s[i] = rho_t[i];
+            for (std::size_t d = 0; d < TDim; d++)
+            {
+               u_s[d*tile_size + i] = u_init[d] + u_t[d*tile_size + i];
+            }
+         }
+
+         StoreFieldsTile<TDim>(fields, false, variables, n, 
+                              tile_size, base, rhoE_per_rho, rho_s, u_s, 
+                              num_pts, rho + begin, rhoV + begin, 
+                              rhoE + begin);
+      }
+   }
+}
+
+template<std::size_t TDim>
+void ComputePhasorKernel(const std::size_t num_pts, const double rho_bar,
+                        const double p_bar, const double *U_bar, 
+                        const double gamma, const int num_waves,
+                        const double *__restrict__ rho_coeffs,
+                        const double *__restrict__ rhoV_coeffs,
+                        const double *__restrict__ cos_omt,
+                        const double *__restrict__ sin_omt,
+                        const double *__restrict__ cos_k_dot_x_p_phi,
+                        const double *__restrict__ sin_k_dot_x_p_phi,
+                        double *__restrict__ rho,
+                        double *__restrict__ rhoV,
+                        double *__restrict__ rhoE,
+                        const FieldMask fields,
+                        const Variables variables)
+{
+   constexpr std::size_t kTile = kDefaultTileSize;
+   const BaseState base = MakeBaseState<TDim>(rho_bar, p_bar, U_bar, gamma);
+   const double rhoE_per_rho = gamma*p_bar/(rho_bar*(gamma-1.0));
+
+   // Base flow velocity summed with the perturbation, if conservative
+   const double zeros[3] = {0.0, 0.0, 0.0};
+   const double *u_init = (variables == Variables::Conservative) ? 
+                              U_bar : zeros;
+
+   const bool velocity = NeedsVelocity(fields);
+
+   // Add contribution of each wave, using
+   // cos(k·x+φ-ωt) = cos(k·x+φ)cos(ωt) + sin(k·x+φ)sin(ωt)
+   // with threads owning disjoint blocks of points
+   const std::size_t num_blocks = (num_pts + kTile - 1)/kTile;
+#ifdef JABBER_WITH_OPENMP
+   #pragma omp parallel for
+#endif // JABBER_WITH_OPENMP
+   for (std::size_t b = 0; b < num_blocks; b++)
+   {
+      const std::size_t begin = b*kTile;
+      const std::size_t n = std::min(kTile, num_pts - begin);
+
+      double rho_t[kTile];
+      double u_t[TDim*kTile];
+      InitPerturbation<TDim, true>(n, kTile, u_init, rho_t, u_t);
+
+      for (int w = 0; w < num_waves; w++)
+      {
+         const double rho_coeff_w = rho_coeffs[w];
+         const double rhoV1_coeff_w = rhoV_coeffs[w];
+         const double rhoV2_coeff_w = TDim > 1 ? 
+                                       rhoV_coeffs[num_waves + w] : 0;
+         const double rhoV3_coeff_w = TDim > 2 ? 
+                                       rhoV_coeffs[2*num_waves + w] : 0;
+         const double cos_omt_w = cos_omt[w];
+         const double sin_omt_w = sin_omt[w];
+
+         const double *__restrict__ cos_w_pts = cos_k_dot_x_p_phi + 
+                                                w*num_pts + begin;
+         const double *__restrict__ sin_w_pts = sin_k_dot_x_p_phi + 
+                                                w*num_pts + begin;
+
+         for (std::size_t i = 0; i < n; i++)
+         {
+            const double cos_w = cos_w_pts[i]*cos_omt_w + 
+                                 sin_w_pts[i]*sin_omt_w;
+
+            rho_t[i] += rho_coeff_w*cos_w;
+            if (velocity)
+            {
+               u_t[i] += rhoV1_coeff_w*cos_w;
+               if constexpr(TDim > 1)
+               {
+                  u_t[kTile + i] += rhoV2_coeff_w*cos_w;
+               }
+               if constexpr(TDim > 2)
+               {
+                  u_t[2*kTile + i] += rhoV3_coeff_w*cos_w;
+               }
+            }
+         }
+      }
+
+      StoreFieldsTile<TDim>(fields, false, variables, n, kTile,
+                              base, rhoE_per_rho, rho_t, u_t, num_pts, 
+                              rho + begin, rhoV + begin, rhoE + begin);
+   }
+}
+
+template<std::size_t TDim>
+void ComputeGEMMKernel(const std::size_t num_pts, const double rho_bar,
+                        const double p_bar, const double *U_bar, 
+                        const double gamma, const int num_waves,
+                        const std::size_t num_times,
+                        const double *__restrict__ times,
+                        const double *__restrict__ rho_coeffs,
+                        const double *__restrict__ rhoV_coeffs,
+                        const double *__restrict__ wave_omegas,
+                        const double *__restrict__ cos_k_dot_x_p_phi,
+                        const double *__restrict__ sin_k_dot_x_p_phi,
+                        double *__restrict__ rho,
+                        double *__restrict__ rhoV,
+                        double *__restrict__ rhoE,
+                        const FieldMask fields,
+                        const Variables variables)
+{
+   constexpr std::size_t kMR = kGEMMTileRows, kNR = kGEMMTileCols;
+   const BaseState base = MakeBaseState<TDim>(rho_bar, p_bar, U_bar, gamma);
+   const double rhoE_per_rho = gamma*p_bar/(rho_bar*(gamma-1.0));
+
+   // Base flow velocity summed with the perturbation, if conservative
+   const double zeros[3] = {0.0, 0.0, 0.0};
+   const double *u_init = (variables == Variables::Conservative) ? 
+                              U_bar : zeros;
+
+   const bool velocity = NeedsVelocity(fields);
+   const std::size_t nw = num_waves;
+
+   // Series of the density perturbation + velocity if needed, with the 
+   // energy following from the density
+   const std::size_t num_series = velocity ? TDim + 1 : 1;
+
+   // Dimensions of product, padded to whole tiles
+   const std::size_t m = num_series*num_times;
+   const std::size_t k = 2*nw;
+   const std::size_t m_pad = (m + kMR - 1)/kMR*kMR;
+
+   // Assemble + pack A into row slivers ordered [sliver][k][row], with 
+   // columns [0,nw) scaling cos(k·x+φ) and [nw,2nw) scaling sin(k·x+φ)
+   std::vector<double> a_packed(m_pad*k, 0.0);
+   for (std::size_t t = 0; t < num_times; t++)
+   {
+      for (std::size_t w = 0; w < nw; w++)
+      {
+         const double omt = wave_omegas[w]*times[t];
+         const double cos_omt = std::cos(omt);
+         const double sin_omt = std::sin(omt);
+         for (std::size_t q = 0; q < num_series; q++)
+         {
+            const double coeff = (q == 0) ? rho_coeffs[w] :
+                                 rhoV_coeffs[(q-1)*nw + w];
+            const std::size_t row = t*num_series + q;
+            double *sliver = a_packed.data() + (row/kMR)*k*kMR + row%kMR;
+            sliver[w*kMR] = coeff*cos_omt;
+            sliver[(nw+w)*kMR] = coeff*sin_omt;
+         }
+      }
+   }
+
+   const std::size_t num_blocks = (num_pts + kGEMMBlockPts - 1)/kGEMMBlockPts;
+
+#ifdef JABBER_WITH_OPENMP
+   #pragma omp parallel
+#endif // JABBER_WITH_OPENMP
+   {
+      std::vector<double> b_packed(kGEMMBlockDepth*kGEMMBlockPts);
+      std::vector<double> c_block(m_pad*kGEMMBlockPts);
+
+#ifdef JABBER_WITH_OPENMP
+      #pragma omp for
+#endif // JABBER_WITH_OPENMP
+      for (std::size_t b = 0; b < num_blocks; b++)
+      {
+         const std::size_t i_begin = b*kGEMMBlockPts;
+         const std::size_t n_b = std::min(kGEMMBlockPts, num_pts - i_begin);
+         const std::size_t n_pad = (n_b + kNR - 1)/kNR*kNR;
+         std::fill(c_block.begin(), c_block.begin() + m_pad*n_pad, 0.0);
+
+         for (std::size_t k_begin = 0; k_begin < k; 
+               k_begin += kGEMMBlockDepth)
+         {
+            const std::size_t depth = std::min(kGEMMBlockDepth, k - k_begin);
+
+            // Pack B into column slivers ordered [sliver][depth][col]
+            for (std::size_t kk = 0; kk < depth; kk++)
+            {
+               const std::size_t row = k_begin + kk;
+               const double *b_row = (row < nw ? 
+                                       cos_k_dot_x_p_phi + row*num_pts :
+                                       sin_k_dot_x_p_phi + (row-nw)*num_pts)
+                                       + i_begin;
+               for (std::size_t j = 0; j < n_pad; j++)
+               {
+                  b_packed[(j/kNR)*depth*kNR + kk*kNR + j%kNR] = 
+                                                (j < n_b) ? b_row[j] : 0.0;
+               }
+            }
+
+            for (std::size_t r = 0; r < m_pad; r += kMR)
+            {
+               const double *a_sliver = a_packed.data() + r*k + 
+                                          k_begin*kMR;
+               for (std::size_t j = 0; j < n_pad; j += kNR)
+               {
+                  GEMMMicroKernel(depth, a_sliver, 
+                                    b_packed.data() + j*depth,
+                                    c_block.data() + r*n_pad + j, n_pad);
+               }
+            }
+         }
+
+         // Add base flow velocity + write each output of the block
+         for (std::size_t t = 0; t < num_times; t++)
+         {
+            double *c_t = c_block.data() + t*num_series*n_pad;
+            for (std::size_t d = 0; velocity && d < TDim; d++)
+            {
+               for (std::size_t j = 0; j < n_b; j++)
+               {
+                  c_t[(d+1)*n_pad + j] += u_init[d];
+               }
+            }
+            StoreFieldsTile<TDim>(fields, false, variables, 
+                              n_b, n_pad, base, rhoE_per_rho, c_t, 
+                              c_t + n_pad, num_pts, 
+                              rho + t*num_pts + i_begin, 
+                              rhoV + t*TDim*num_pts + i_begin, 
+                              rhoE + t*num_pts + i_begin);
+         }
+      }
+   }
+}
+
+template<std::size_t TDim>
+void ComputeOnTheFlyKernel(const std::size_t num_pts, const double rho_bar,
+                        const double p_bar, const double *U_bar, 
+                        const double gamma, const int num_waves,
+                        const double t,
+                        const double *__restrict__ rho_coeffs,
+                        const double *__restrict__ rhoV_coeffs,
+                        const double *__restrict__ wave_omegas,
+                        const double *__restrict__ wave_ks,
+                        const double *__restrict__ wave_phases,
+                        const double *__restrict__ coords,
+                        double *__restrict__ rho,
+                        double *__restrict__ rhoV,
+                        double *__restrict__ rhoE,
+                        const FieldMask fields,
+                        const Variables variables)
+{
+   const BaseState base = MakeBaseState<TDim>(rho_bar, p_bar, U_bar, gamma);
+   const double rhoE_per_rho = gamma*p_bar/(rho_bar*(gamma-1.0));
+
+   // Base flow velocity summed with the perturbation, if conservative
+   const double zeros[3] = {0.0, 0.0, 0.0};
+   const double *u_init = (variables == Variables::Conservative) ? 
+                              U_bar : zeros;
+
+   const bool velocity = NeedsVelocity(fields);
+   const std::size_t num_tiles = (num_pts + kSumTileSize - 1)/
+                                    kSumTileSize;
+
+#ifdef JABBER_WITH_OPENMP
+   #pragma omp parallel for
+#endif // JABBER_WITH_OPENMP
+   for (std::size_t b = 0; b < num_tiles; b++)
+   {
+      const std::size_t begin = b*kSumTileSize;
+      const std::size_t n = std::min(kSumTileSize, num_pts - begin);
+
+      double rho_t[kSumTileSize];
+      double u_t[TDim*kSumTileSize];
+      for (std::size_t i = 0; i < n; i++)
+      {
+         const std::size_t pt = begin + i;
+         const double x_i = coords[pt];
+         const double y_i = TDim > 1 ? coords[num_pts + pt] : 0.0;
+         const double z_i = TDim > 2 ? coords[2*num_pts + pt] : 0.0;
+
+         double rho_i = 0.0;
+         double u_i[TDim];
+         for (std::size_t d = 0; d < TDim; d++)
+         {
+            u_i[d] = u_init[d];
+         }
+
+         for (int w = 0; w < num_waves; w++)
+         {
+            double k_dot_x_p_phi = wave_phases[w] + wave_ks[w]*x_i;
+            if constexpr (TDim > 1)
+            {
+               k_dot_x_p_phi += wave_ks[num_waves + w]*y_i;
+            }
+            if constexpr (TDim > 2)
+            {
+               k_dot_x_p_phi += wave_ks[2*num_waves + w]*z_i;
+            }
+            const double omt = wave_omegas[w]*t;
+            const double cos_w = std::cos(k_dot_x_p_phi - omt);
+
+            rho_i += rho_coeffs[w]*cos_w;
+            if (velocity)
+            {
+               for (std::size_t d = 0; d < TDim; d++)
+               {
+                  u_i[d] += rhoV_coeffs[d*num_waves + w]*cos_w;
+               }
+            }
+         }
+
+         rho_t[i] = rho_i;
+         for (std::size_t d = 0; d < TDim; d++)
+         {
+            u_t[d*kSumTileSize + i] = u_i[d];
+         }
+      }
+
+      // Write each output of the tile once
+      StoreFieldsTile<TDim>(fields, false, variables, n, 
+                              kSumTileSize, base, rhoE_per_rho, rho_t, u_t,
+                              num_pts, rho + begin, rhoV + begin, 
+                              rhoE + begin);
+   }
+}
+
+template<std::size_t TDim>
+void ComputeUnrolledKernel(const std::size_t num_pts, const double rho_bar,
+                        const double p_bar, const double *U_bar, 
+                        const double gamma, const int num_waves,
+                        const double t,
+                        const double *__restrict__ rho_coeffs,
+                        const double *__restrict__ rhoV_coeffs,
+                        const double *__restrict__ wave_omegas,
+                        const double *__restrict__ wave_ks,
+                        const double *__restrict__ wave_phases,
+                        const double *__restrict__ coords,
+                        double *__restrict__ rho,
+                        double *__restrict__ rhoV,
+                        double *__restrict__ rhoE,
+                        const Accuracy accuracy,
+                        const FieldMask fields,
+                        const Variables variables)
+{
+   switch (accuracy)
+   {
+      case Accuracy::Exact:
+         ComputeUnrolledKernelImpl<TDim, Accuracy::Exact>(num_pts, rho_bar,
+                        p_bar, U_bar, gamma, num_waves, t, rho_coeffs, 
+                        rhoV_coeffs, wave_omegas, wave_ks, wave_phases, 
+                        coords, rho, rhoV, rhoE, fields, variables);
+         break;
+      case Accuracy::High:
+         ComputeUnrolledKernelImpl<TDim, Accuracy::High>(num_pts, rho_bar,
+                        p_bar, U_bar, gamma, num_waves, t, rho_coeffs, 
+                        rhoV_coeffs, wave_omegas, wave_ks, wave_phases, 
+                        coords, rho, rhoV, rhoE, fields, variables);
+         break;
+      case Accuracy::Low:
+         ComputeUnrolledKernelImpl<TDim, Accuracy::Low>(num_pts, rho_bar,
+                        p_bar, U_bar, gamma, num_waves, t, rho_coeffs, 
+                        rhoV_coeffs, wave_omegas, wave_ks, wave_phases, 
+                        coords, rho, rhoV, rhoE, fields, variables);
+         break;
+      default:
+         throw std::logic_error("Unimplemented accuracy!");
+   }
+}
+
+template<std::size_t TDim>
+void ComputeExpansionKernel(const std::size_t num_pts, const double rho_bar,
+                        const double p_bar, const double *U_bar, 
+                        const double gamma, const int num_waves,
+                        const double t,
+                        const double *__restrict__ rho_coeffs,
+                        const double *__restrict__ rhoV_coeffs,
+                        const double *__restrict__ wave_omegas,
+                        const double *__restrict__ wave_ks,
+                        const double *__restrict__ wave_phases,
+                        const std::size_t num_tiles,
+                        const std::size_t *__restrict__ tile_offsets,
+                        const std::size_t *__restrict__ tile_pts,
+                        const double *__restrict__ tile_centers,
+                        const int *__restrict__ tile_orders,
+                        const double *__restrict__ tile_deltas,
+                        double *__restrict__ rho,
+                        double *__restrict__ rhoV,
+                        double *__restrict__ rhoE,
+                        const FieldMask fields,
+                        const Variables variables)
+{
+   constexpr std::size_t kChunk = kExpansionChunkSize;
+   const BaseState base = MakeBaseState<TDim>(rho_bar, p_bar, U_bar, gamma);
+   const double rhoE_per_rho = gamma*p_bar/(rho_bar*(gamma-1.0));
+
+   // Base flow velocity summed with the perturbation, if conservative
+   const double zeros[3] = {0.0, 0.0, 0.0};
+   const double *u_init = (variables == Variables::Conservative) ? 
+                              U_bar : zeros;
+
+   const bool velocity = NeedsVelocity(fields);
+   const std::size_t nw = num_waves;
+
+#ifdef JABBER_WITH_OPENMP
+   #pragma omp parallel
+#endif // JABBER_WITH_OPENMP
+   {
+      // Per-wave center phasors and per-point sums
+      std::vector<double> work(2*nw + (TDim+1)*kChunk);
+      double *__restrict__ cos_c = work.data();
+      double *__restrict__ sin_c = cos_c + nw;
+      double *__restrict__ rho_t = sin_c + nw;
+      double *__restrict__ u_t = rho_t + kChunk;
+
+#ifdef JABBER_WITH_OPENMP
+      #pragma omp for schedule(dynamic)
+#endif // JABBER_WITH_OPENMP
+      for (std::size_t b = 0; b < num_tiles; b++)
+      {
+         // One sincos pair per wave at the tile center
+         const double *x_c = tile_centers + b*TDim;
+         for (std::size_t w = 0; w < nw; w++)
+         {
+            double theta_c = wave_phases[w];
+            for (std::size_t d = 0; d < TDim; d++)
+            {
+               theta_c += wave_ks[d*nw + w]*x_c[d];
+            }
+            theta_c -= wave_omegas[w]*t;
+            cos_c[w] = std::cos(theta_c);
+            sin_c[w] = std::sin(theta_c);
+         }
+
+         for (std::size_t begin = tile_offsets[b]; begin < tile_offsets[b+1];
+               begin += kChunk)
+         {
+            const std::size_t n = std::min(kChunk, tile_offsets[b+1] - begin);
+            InitPerturbation<TDim, true>(n, kChunk, u_init, rho_t, u_t);
+
+            // Dispatch to expansion order of tile, with -1 as exact
+            [&]<int... TOrders>(const std::integer_sequence<int, TOrders...>&)
+            {
+               ([&]()
+                {
+                  if (tile_orders[b] == TOrders - 1)
+                  {
+                     AccumulateExpansion<TDim, TOrders - 1>(n, nw, 
+                                          rho_coeffs, rhoV_coeffs, wave_ks,
+                                          cos_c, sin_c, num_pts, 
+                                          tile_deltas + begin, velocity,
+                                          rho_t, u_t);
+                  }
+                }(), ...);
+            }(std::make_integer_sequence<int, kMaxExpansionOrder + 2>{});
+
+            // Scatter the outputs to each point
+            StoreFieldsScattered<TDim>(fields, variables, n,
+                                 kChunk, tile_pts + begin, base, 
+                                 rhoE_per_rho, rho_t, u_t, num_pts, rho, 
+                                 rhoV, rhoE);
+         }
+      }
+   }
+}
+
+template<std::size_t TDim>
+void ComputeLowRankKernel(const std::size_t num_pts, const double rho_bar,
+                        const double p_bar, const double *U_bar, 
+                        const double gamma, const int num_waves,
+                        const double t,
+                        const double *__restrict__ rho_coeffs,
+                        const double *__restrict__ rhoV_coeffs,
+                        const double *__restrict__ wave_omegas,
+                        const int rank,
+                        const double *__restrict__ basis,
+                        const double *__restrict__ factors,
+                        double *__restrict__ rho,
+                        double *__restrict__ rhoV,
+                        double *__restrict__ rhoE,
+                        const FieldMask fields,
+                        const Variables variables)
+{
+   const BaseState base = MakeBaseState<TDim>(rho_bar, p_bar, U_bar, gamma);
+   const double rhoE_per_rho = gamma*p_bar/(rho_bar*(gamma-1.0));
+
+   // Base flow velocity summed with the perturbation, if conservative
+   const double zeros[3] = {0.0, 0.0, 0.0};
+   const double *u_init = (variables == Variables::Conservative) ? 
+                              U_bar : zeros;
+
+   const std::size_t nw = num_waves;
+   const std::size_t r = rank;
+
+   // Series of the density perturbation + velocity if needed, with the 
+   // energy following from the density
+   const std::size_t num_series = NeedsVelocity(fields) ? TDim + 1 : 1;
+
+   // Project the time phasors of each series onto the basis
+   std::vector<double> weights(num_series*r, 0.0);
+   for (std::size_t w = 0; w < nw; w++)
+   {
+      const double cos_omt = std::cos(wave_omegas[w]*t);
+      const double sin_omt = std::sin(wave_omegas[w]*t);
+      const double *q_cos = basis + w*r;
+      const double *q_sin = basis + (nw + w)*r;
+
+      for (std::size_t s = 0; s < num_series; s++)
+      {
+         const double coeff = (s == 0) ? rho_coeffs[w] : 
+                              rhoV_coeffs[(s-1)*nw + w];
+         const double a_cos = coeff*cos_omt;
+         const double a_sin = coeff*sin_omt;
+         double *weights_s = weights.data() + s*r;
+         for (std::size_t k = 0; k < r; k++)
+         {
+            weights_s[k] += a_cos*q_cos[k] + a_sin*q_sin[k];
+         }
+      }
+   }
+
+   const std::size_t num_tiles = (num_pts + kSumTileSize - 1)/
+                                    kSumTileSize;
+
+#ifdef JABBER_WITH_OPENMP
+   #pragma omp parallel for
+#endif // JABBER_WITH_OPENMP
+   for (std::size_t b = 0; b < num_tiles; b++)
+   {
+      const std::size_t begin = b*kSumTileSize;
+      const std::size_t n = std::min(kSumTileSize, num_pts - begin);
+
+      // Sums of each series, ordered [rho][u], with the base flow velocity
+      double sums_t[(TDim+1)*kSumTileSize];
+      for (std::size_t i = 0; i < n; i++)
+      {
+         const double *__restrict__ f = factors + (begin + i)*r;
+         double sums[TDim+1] = {};
+         for (std::size_t k = 0; k < r; k++)
+         {
+            for (std::size_t s = 0; s < num_series; s++)
+            {
+               sums[s] += weights[s*r + k]*f[k];
+            }
+         }
+
+         sums_t[i] = sums[0];
+         for (std::size_t d = 0; d < TDim; d++)
+         {
+            sums_t[(d+1)*kSumTileSize + i] = u_init[d] + sums[d+1];
+         }
+      }
+
+      StoreFieldsTile<TDim>(fields, false, variables, n, 
+                              kSumTileSize, base, rhoE_per_rho, sums_t, 
+                              sums_t + kSumTileSize, num_pts, rho + begin,
+                              rhoV + begin, rhoE + begin);
+   }
+}
+
+template<std::size_t TDim>
+void ComputeBandKernel(const std::size_t num_pts, const int num_waves,
+                        const double t,
+                        const double *__restrict__ rho_coeffs,
+                        const double *__restrict__ rhoV_coeffs,
+                        const double *__restrict__ wave_omegas,
+                        const double *__restrict__ wave_ks,
+                        const double *__restrict__ wave_phases,
+                        const double *__restrict__ coords,
+                        double *__restrict__ sums,
+                        double *__restrict__ rates,
+                        const FieldMask fields)
+{
+   // Series of the density perturbation + velocity if needed, with the 
+   // energy following from the density
+   constexpr std::size_t kNumSeries = TDim + 1;
+   const std::size_t num_series = NeedsVelocity(fields) ? kNumSeries : 1;
+
+   const auto sum_band = [&](const auto with_rates)
+   {
+      constexpr bool kRates = decltype(with_rates)::value;
+
+#ifdef JABBER_WITH_OPENMP
+      #pragma omp parallel for
+#endif // JABBER_WITH_OPENMP
+      for (std::size_t i = 0; i < num_pts; i++)
+      {
+         const double x_i = coords[i];
+         const double y_i = TDim > 1 ? coords[num_pts + i] : 0.0;
+         const double z_i = TDim > 2 ? coords[2*num_pts + i] : 0.0;
+
+         double sum_i[kNumSeries] = {};
+         double rate_i[kNumSeries] = {};
+         for (int w = 0; w < num_waves; w++)
+         {
+            double theta = wave_phases[w] + wave_ks[w]*x_i;
+            if constexpr (TDim > 1)
+            {
+               theta += wave_ks[num_waves + w]*y_i;
+            }
+            if constexpr (TDim > 2)
+            {
+               theta += wave_ks[2*num_waves + w]*z_i;
+            }
+            theta -= wave_omegas[w]*t;
+            const double cos_w = std::cos(theta);
+
+            sum_i[0] += rho_coeffs[w]*cos_w;
+            for (std::size_t s = 1; s < num_series; s++)
+            {
+               sum_i[s] += rhoV_coeffs[(s-1)*num_waves + w]*cos_w;
+            }
+
+            if constexpr (kRates)
+            {
+               const double omega_sin_w = wave_omegas[w]*std::sin(theta);
+               rate_i[0] += rho_coeffs[w]*omega_sin_w;
+               for (std::size_t s = 1; s < num_series; s++)
+               {
+                  rate_i[s] += rhoV_coeffs[(s-1)*num_waves + w]*omega_sin_w;
+               }
+            }
+         }
+
+         for (std::size_t s = 0; s < num_series; s++)
+         {
+            sums[s*num_pts + i] += sum_i[s];
+            if constexpr (kRates)
+            {
+               rates[s*num_pts + i] += rate_i[s];
+            }
+         }
+      }
+   };
+
+   if (rates)
+   {
+      sum_band(std::true_type{});
+   }
+   else
+   {
+      sum_band(std::false_type{});
+   }
+}
+
+template<std::size_t TDim>
+void ComputeMultiRateKernel(const std::size_t num_pts, const double rho_bar,
+                        const double p_bar, const double *U_bar, 
+                        const double gamma, const int num_terms,
+                        const double *const *terms,
+                        const double *weights,
+                        double *__restrict__ rho,
+                        double *__restrict__ rhoV,
+                        double *__restrict__ rhoE,
+                        const FieldMask fields,
+                        const Variables variables)
+{
+   const BaseState base = MakeBaseState<TDim>(rho_bar, p_bar, U_bar, gamma);
+   const double rhoE_per_rho = gamma*p_bar/(rho_bar*(gamma-1.0));
+
+   // Base flow velocity summed with the perturbation, if conservative
+   const double zeros[3] = {0.0, 0.0, 0.0};
+   const double *u_init = (variables == Variables::Conservative) ? 
+                              U_bar : zeros;
+
+   const bool velocity = NeedsVelocity(fields);
+   const std::size_t num_tiles = (num_pts + kSumTileSize - 1)/
+                                    kSumTileSize;
+
+#ifdef JABBER_WITH_OPENMP
+   #pragma omp parallel for
+#endif // JABBER_WITH_OPENMP
+   for (std::size_t b = 0; b < num_tiles; b++)
+   {
+      const std::size_t begin = b*kSumTileSize;
+      const std::size_t n = std::min(kSumTileSize, num_pts - begin);
+
+      double rho_t[kSumTileSize];
+      double u_t[TDim*kSumTileSize];
+      for (std::size_t i = 0; i < n; i++)
+      {
+         const std::size_t pt = begin + i;
+         double rho_i = 0.0;
+         double u_i[TDim];
+         for (std::size_t d = 0; d < TDim; d++)
+         {
+            u_i[d] = u_init[d];
+         }
+
+         for (int m = 0; m < num_terms; m++)
+         {
+            const double *term = terms[m];
+            const double weight = weights[m];
+            rho_i += weight*term[pt];
+            if (velocity)
+            {
+               for (std::size_t d = 0; d < TDim; d++)
+               {
+                  u_i[d] += weight*term[(d+1)*num_pts + pt];
+               }
+            }
+         }
+
+         rho_t[i] = rho_i;
+         for (std::size_t d = 0; d < TDim; d++)
+         {
+            u_t[d*kSumTileSize + i] = u_i[d];
+         }
+      }
+
+      StoreFieldsTile<TDim>(fields, false, variables, n, 
+                              kSumTileSize, base, rhoE_per_rho, rho_t, u_t,
+                              num_pts, rho + begin, rhoV + begin, 
+                              rhoE + begin);
+   }
+}
+
+template<std::size_t TDim>
+void ComputeCollapsedKernel(const std::size_t num_pts, const double rho_bar,
+                        const double p_bar, const double *U_bar, 
+                        const double gamma, const int num_groups,
+                        const int *__restrict__ group_offsets,
+                        const double *__restrict__ group_k_hats,
+                        const std::size_t *__restrict__ proj_offsets,
+                        const double *__restrict__ projs,
+                        const std::size_t *__restrict__ pt_proj_idxs,
+                        const double t,
+                        const double *__restrict__ rho_coeffs,
+                        const double *__restrict__ rhoV_coeffs,
+                        const double *__restrict__ wave_omegas,
+                        const double *__restrict__ wave_k_mags,
+                        const double *__restrict__ wave_phases,
+                        double *__restrict__ proj_sums,
+                        double *__restrict__ rho,
+                        double *__restrict__ rhoV,
+                        double *__restrict__ rhoE,
+                        const Accuracy accuracy,
+                        const FieldMask fields,
+                        const Variables variables)
+{
+   switch (accuracy)
+   {
+      case Accuracy::Exact:
+         ComputeCollapsedKernelImpl<TDim, Accuracy::Exact>(num_pts, rho_bar,
+                        p_bar, U_bar, gamma, num_groups, group_offsets, 
+                        group_k_hats, proj_offsets, projs, pt_proj_idxs, t,
+                        rho_coeffs, rhoV_coeffs, wave_omegas, wave_k_mags, 
+                        wave_phases, proj_sums, rho, rhoV, rhoE, fields, 
+                        variables);
+         break;
+      case Accuracy::High:
+         ComputeCollapsedKernelImpl<TDim, Accuracy::High>(num_pts, rho_bar,
+                        p_bar, U_bar, gamma, num_groups, group_offsets, 
+                        group_k_hats, proj_offsets, projs, pt_proj_idxs, t,
+                        rho_coeffs, rhoV_coeffs, wave_omegas, wave_k_mags, 
+                        wave_phases, proj_sums, rho, rhoV, rhoE, fields, 
+                        variables);
+         break;
+      case Accuracy::Low:
+         ComputeCollapsedKernelImpl<TDim, Accuracy::Low>(num_pts, rho_bar,
+                        p_bar, U_bar, gamma, num_groups, group_offsets, 
+                        group_k_hats, proj_offsets, projs, pt_proj_idxs, t,
+                        rho_coeffs, rhoV_coeffs, wave_omegas, wave_k_mags, 
+                        wave_phases, proj_sums, rho, rhoV, rhoE, fields, 
+                        variables);
+         break;
+      default:
+         throw std::logic_error("Unimplemented accuracy!");
+   }
+}
+
+template<std::size_t TDim>
+void ComputeRecurrenceKernel(const std::size_t num_pts, const double rho_bar,
+                        const double p_bar, const double *U_bar, 
+                        const double gamma, const int num_progs,
+                        const int *__restrict__ prog_offsets,
+                        const double *__restrict__ prog_k_hats,
+                        const double *__restrict__ prog_factors,
+                        const double *__restrict__ prog_ks,
+                        const double *__restrict__ prog_omegas,
+                        const double t,
+                        const double *__restrict__ amps_cos_phi,
+                        const double *__restrict__ amps_sin_phi,
+                        const double *__restrict__ coords,
+                        double *__restrict__ rho,
+                        double *__restrict__ rhoV,
+                        double *__restrict__ rhoE,
+                        const FieldMask fields,
+                        const Variables variables)
+{
+   DispatchFields(fields, [&](const auto mask)
+   {
+      ComputeRecurrenceKernelImpl<TDim, decltype(mask)::value>(num_pts, 
+                        rho_bar, p_bar, U_bar, gamma, num_progs, 
+                        prog_offsets, prog_k_hats, prog_factors, prog_ks,
+                        prog_omegas, t, amps_cos_phi, amps_sin_phi, coords,
+                        rho, rhoV, rhoE, variables);
+   });
+}
+
+template<std::size_t TDim>
+void ComputeNUFFTKernel(const std::size_t num_pts, const double rho_bar,
+                        const double p_bar, const double *U_bar, 
+                        const double gamma, const int num_waves,
+                        const double t,
+                        const double *__restrict__ rho_coeffs,
+                        const double *__restrict__ rhoV_coeffs,
+                        const double *__restrict__ wave_omegas,
+                        const double *__restrict__ wave_ks,
+                        const double *__restrict__ wave_phases,
+                        const double *__restrict__ coords,
+                        NUFFTPlan &plan,
+                        double *__restrict__ rho,
+                        double *__restrict__ rhoV,
+                        double *__restrict__ rhoE,
+                        const FieldMask fields,
+                        const Variables variables)
+{
+   const BaseState base = MakeBaseState<TDim>(rho_bar, p_bar, U_bar, gamma);
+   const double rhoE_per_rho = gamma*p_bar/(rho_bar*(gamma-1.0));
+
+   // Base flow velocity summed with the perturbation, if conservative
+   const double zeros[3] = {0.0, 0.0, 0.0};
+   const double *u_init = (variables == Variables::Conservative) ? 
+                              U_bar : zeros;
+
+   const bool velocity = NeedsVelocity(fields);
+
+   // Strengths of each channel (rho, each of u if needed) with phase folded
+   // in, the energy following from the density
+   const std::size_t num_channels = velocity ? TDim + 1 : 1;
+   const std::size_t nw = num_waves;
+   std::vector<std::complex<double>> strengths(num_channels*nw);
+   for (std::size_t w = 0; w < nw; w++)
+   {
+      const std::complex<double> phasor = 
+                     std::polar(1.0, wave_phases[w] - wave_omegas[w]*t);
+      strengths[w] = rho_coeffs[w]*phasor;
+      for (std::size_t q = 1; q < num_channels; q++)
+      {
+         strengths[q*nw + w] = rhoV_coeffs[(q-1)*nw + w]*phasor;
+      }
+   }
+
+   std::vector<double> sums(num_channels*num_pts);
+   double *out[TDim+1];
+   for (std::size_t q = 0; q < num_channels; q++)
+   {
+      out[q] = sums.data() + q*num_pts;
+   }
+   plan.Execute(coords, wave_ks, strengths.data(), out);
+
+   // Add base flow velocity + write the outputs by tile
+   double *rho_s = sums.data();
+   double *u_s = rho_s + num_pts;
+   const std::size_t num_tiles = (num_pts + kSumTileSize - 1)/kSumTileSize;
+#ifdef JABBER_WITH_OPENMP
+   #pragma omp parallel for
+#endif // JABBER_WITH_OPENMP
+   for (std::size_t b = 0; b < num_tiles; b++)
+   {
+      const std::size_t begin = b*kSumTileSize;
+      const std::size_t n = std::min(kSumTileSize, num_pts - begin);
+      for (std::size_t d = 0; velocity && d < TDim; d++)
+      {
+         for (std::size_t i = begin; i < begin + n; i++)
+         {
+            u_s[d*num_pts + i] += u_init[d];
+         }
+      }
+      StoreFieldsTile<TDim>(fields, false, variables, n, 
+                              num_pts, base, rhoE_per_rho, rho_s + begin, 
+                              u_s + begin, num_pts, rho + begin, 
+                              rhoV + begin, rhoE + begin);
+   }
+}
+
+template<std::size_t TDim>
+void ComputeSynthesisKernel(const std::size_t num_pts, const double rho_bar,
+                        const double p_bar, const double *U_bar, 
+                        const double gamma, const int num_progs,
+                        const int *__restrict__ prog_offsets,
+                        const double *__restrict__ prog_factors,
+                        const double t,
+                        const double *__restrict__ wave_omegas,
+                        const double *__restrict__ amps_cos_phi,
+                        const double *__restrict__ amps_sin_phi,
+                        ProgressionFFTPlan *plans,
+                        double *__restrict__ rho,
+                        double *__restrict__ rhoV,
+                        double *__restrict__ rhoE,
+                        const FieldMask fields,
+                        const Variables variables)
+{
+   constexpr std::size_t kNumSeries = TDim + 2;
+   const BaseState base = MakeBaseState<TDim>(rho_bar, p_bar, U_bar, gamma);
+   const double rhoE_per_rho = gamma*p_bar/(rho_bar*(gamma-1.0));
+   const bool velocity = NeedsVelocity(fields);
+
+   // Density + velocity perturbations, with the velocity summed from the 
+   // base flow velocity if conservative
+   std::vector<double> sums((1 + TDim)*num_pts, 0.0);
+   double *rho_s = sums.data();
+   double *u_s = sums.data() + num_pts;
+   for (std::size_t d = 0; d < TDim; d++)
+   {
+      const double u_init = (variables == Variables::Conservative) ? 
+                              U_bar[d] : 0.0;
+      std::fill(u_s + d*num_pts, u_s + (d+1)*num_pts, u_init);
+   }
+
+   std::vector<std::complex<double>> strengths;
+   std::vector<double> signal(num_pts);
+   for (int p = 0; p < num_progs; p++)
+   {
+      // Strengths A_j e^{i(φ_j-ω_j t)} of the progression at t
+      const int first = prog_offsets[p];
+      const int num_waves = prog_offsets[p+1] - first;
+      strengths.resize(num_waves);
+      for (int j = 0; j < num_waves; j++)
+      {
+         const int w = first + j;
+         strengths[j] = std::complex<double>(amps_cos_phi[w], 
+                                             amps_sin_phi[w])*
+                        std::polar(1.0, -wave_omegas[w]*t);
+      }
+      plans[p].Execute(strengths.data(), signal.data());
+
+      // Scale to the density + velocity series, the energy following from
+      // the density
+      const double *factors = prog_factors + p*kNumSeries;
+#ifdef JABBER_WITH_OPENMP
+      #pragma omp parallel for
+#endif // JABBER_WITH_OPENMP
+      for (std::size_t i = 0; i < num_pts; i++)
+      {
+         rho_s[i] += factors[0]*signal[i];
+         if (velocity)
+         {
+            for (std::size_t d = 0; d < TDim; d++)
+            {
+               u_s[d*num_pts + i] += factors[1+d]*signal[i];
+            }
+         }
+      }
+   }
+
+   // Write the outputs by tile
+   const std::size_t num_tiles = (num_pts + kSumTileSize - 1)/kSumTileSize;
+#ifdef JABBER_WITH_OPENMP
+   #pragma omp parallel for
+#endif // JABBER_WITH_OPENMP
+   for (std::size_t b = 0; b < num_tiles; b++)
+   {
+      const std::size_t begin = b*kSumTileSize;
+      const std::size_t n = std::min(kSumTileSize, num_pts - begin);
+      StoreFieldsTile<TDim>(fields, false, variables, n, num_pts, base, 
+                              rhoE_per_rho, rho_s + begin, u_s + begin, 
+                              num_pts, rho + begin, rhoV + begin, 
+                              rhoE + begin);
+   }
+}
+
+// Explicit instantiation for Dims 1-3
+template<std::size_t TDim>
+void ComputeSIMDKernel(const std::size_t num_pts, const double rho_bar,
+                        const double p_bar, const double *U_bar, 
+                        const double gamma, const int num_waves,
+                        const double t,
+                        const double *__restrict__ rho_coeffs,
+                        const double *__restrict__ rhoV_coeffs,
+                        const double *__restrict__ wave_omegas,
+                        const double *__restrict__ k_dot_x_p_phi,
+                        double *__restrict__ rho,
+                        double *__restrict__ rhoV,
+                        double *__restrict__ rhoE,
+                        const FieldMask fields,
+                        const Variables variables)
+{
+   const BaseState base = MakeBaseState<TDim>(rho_bar, p_bar, U_bar, gamma);
+   const double rhoE_per_rho = gamma*p_bar/(rho_bar*(gamma-1.0));
+
+   // Base flow velocity summed with the perturbation, if conservative
+   const double zeros[3] = {0.0, 0.0, 0.0};
+   const double *u_init = (variables == Variables::Conservative) ? 
+                              U_bar : zeros;
+
+   const bool velocity = NeedsVelocity(fields);
+   const InstructionSet isa = SIMDInstructionSet();
+   const std::size_t num_tiles = (num_pts + kSumTileSize - 1)/
+                                    kSumTileSize;
+
+#ifdef JABBER_WITH_OPENMP
+   #pragma omp parallel for
+#endif // JABBER_WITH_OPENMP
+   for (std::size_t b = 0; b < num_tiles; b++)
+   {
+      const std::size_t begin = b*kSumTileSize;
+      const std::size_t n = std::min(kSumTileSize, num_pts - begin);
+
+      double rho_t[kSumTileSize];
+      double u_t[TDim*kSumTileSize];
+      InitPerturbation<TDim, true>(n, kSumTileSize, u_init, rho_t, u_t);
+
+      // Add contribution of each wave
+      switch (isa)
+      {
+#ifdef JABBER_WITH_X86_SIMD
+      case InstructionSet::AVX512:
+         simd::avx512::AccumulateWaves<TDim>(n, kSumTileSize, num_waves, t,
+                                          rho_coeffs, rhoV_coeffs, 
+                                          wave_omegas, num_pts,
+                                          k_dot_x_p_phi + begin, velocity,
+                                          rho_t, u_t);
+         break;
+      case InstructionSet::AVX2:
+         simd::avx2::AccumulateWaves<TDim>(n, kSumTileSize, num_waves, t,
+                                          rho_coeffs, rhoV_coeffs, 
+                                          wave_omegas, num_pts,
+                                          k_dot_x_p_phi + begin, velocity,
+                                          rho_t, u_t);
+         break;
+#endif // JABBER_WITH_X86_SIMD
+      default:
+         simd::baseline::AccumulateWaves<TDim>(n, kSumTileSize, num_waves,
+                                          t, rho_coeffs, rhoV_coeffs, 
+                                          wave_omegas, num_pts,
+                                          k_dot_x_p_phi + begin, velocity,
+                                          rho_t, u_t);
+         break;
+      }
+
+      StoreFieldsTile<TDim>(fields, false, variables, n, 
+                              kSumTileSize, base, rhoE_per_rho, rho_t, u_t,
+                              num_pts, rho + begin, rhoV + begin, 
+                              rhoE + begin);
+   }
+}
+
+template<std::size_t TDim>
+void ComputeStructuredKernel(const std::size_t *counts, const double rho_bar,
+                              const double p_bar, const double *U_bar, 
+                              const double gamma, const int num_waves,
+                              const double *__restrict__ rho_coeffs,
+                              const double *__restrict__ rhoV_coeffs,
+                              const double *__restrict__ cos_omt,
+                              const double *__restrict__ sin_omt,
+                              const double *__restrict__ axis_cos_k_x,
+                              const double *__restrict__ axis_sin_k_x,
+                              double *__restrict__ rho,
+                              double *__restrict__ rhoV,
+                              double *__restrict__ rhoE,
+                              const FieldMask fields,
+                              const Variables variables)
+{
+   const BaseState base = MakeBaseState<TDim>(rho_bar, p_bar, U_bar, gamma);
+   const double rhoE_per_rho = gamma*p_bar/(rho_bar*(gamma-1.0));
+
+   // Base flow velocity summed with the perturbation, if conservative
+   const double zeros[3] = {0.0, 0.0, 0.0};
+   const double *u_init = (variables == Variables::Conservative) ? 
+                              U_bar : zeros;
+
+   const bool velocity = NeedsVelocity(fields);
+
+   // Points are processed in rows along the last (fastest) axis, with each
+   // row split into tiles
+   const std::size_t row_size = counts[TDim-1];
+   std::size_t num_rows = 1;
+   for (std::size_t d = 0; d + 1 < TDim; d++)
+   {
+      num_rows *= counts[d];
+   }
+   const std::size_t num_pts = num_rows*row_size;
+   const std::size_t tile_size = std::min(row_size, kDefaultTileSize);
+   const std::size_t num_row_tiles = (row_size + tile_size - 1)/tile_size;
+
+   // Offset of each axis in axis_cos_k_x/axis_sin_k_x
+   std::size_t axis_offsets[TDim];
+   std::size_t offset = 0;
+   for (std::size_t d = 0; d < TDim; d++)
+   {
+      axis_offsets[d] = offset;
+      offset += num_waves*counts[d];
+   }
+
+   // Only bypass the cache for outputs that would not fit in it anyways
+   const bool nontemporal = 
+               (2+TDim)*num_pts*sizeof(double) > kNonTemporalStoreBytes;
+
+#ifdef JABBER_WITH_OPENMP
+   #pragma omp parallel
+#endif // JABBER_WITH_OPENMP
+   {
+      std::vector<double> tile((1+TDim)*tile_size);
+      double *__restrict__ rho_t = tile.data();
+      double *__restrict__ u_t = rho_t + tile_size;
+
+#ifdef JABBER_WITH_OPENMP
+      #pragma omp for
+#endif // JABBER_WITH_OPENMP
+      for (std::size_t b = 0; b < num_rows*num_row_tiles; b++)
+      {
+         const std::size_t r = b/num_row_tiles;
+         const std::size_t begin = (b%num_row_tiles)*tile_size;
+         const std::size_t n = std::min(tile_size, row_size - begin);
+
+         // Indices of row along leading axes
+         const std::size_t i0 = TDim == 3 ? r/counts[1] : r;
+         const std::size_t i1 = TDim == 3 ? r%counts[1] : 0;
+
+         InitPerturbation<TDim, true>(n, tile_size, u_init, rho_t, u_t);
+
+         // Add contribution of each wave
+         for (int w = 0; w < num_waves; w++)
+         {
+            const double rho_coeff_w = rho_coeffs[w];
+            const double rhoV1_coeff_w = rhoV_coeffs[w];
+            const double rhoV2_coeff_w = TDim > 1 ? 
+                                          rhoV_coeffs[num_waves + w] : 0;
+            const double rhoV3_coeff_w = TDim > 2 ? 
+                                          rhoV_coeffs[2*num_waves + w] : 0;
+
+            // Combine e^{-iωt} with the phasors of the leading axes
+            double c_re = cos_omt[w];
+            double c_im = -sin_omt[w];
+            if constexpr (TDim > 1)
+            {
+               const std::size_t idx = axis_offsets[0] + w*counts[0] + i0;
+               const double a_re = axis_cos_k_x[idx];
+               const double a_im = axis_sin_k_x[idx];
+               const double re = c_re*a_re - c_im*a_im;
+               c_im = c_re*a_im + c_im*a_re;
+               c_re = re;
+            }
+            if constexpr (TDim > 2)
+            {
+               const std::size_t idx = axis_offsets[1] + w*counts[1] + i1;
+               const double a_re = axis_cos_k_x[idx];
+               const double a_im = axis_sin_k_x[idx];
+               const double re = c_re*a_re - c_im*a_im;
+               c_im = c_re*a_im + c_im*a_re;
+               c_re = re;
+            }
+
+            const std::size_t row_offset = axis_offsets[TDim-1] + 
+                                             w*row_size + begin;
+            const double *__restrict__ cos_k_x = axis_cos_k_x + row_offset;
+            const double *__restrict__ sin_k_x = axis_sin_k_x + row_offset;
+
+            for (std::size_t i = 0; i < n; i++)
+            {
+               const double cos_w = c_re*cos_k_x[i] - c_im*sin_k_x[i];
+
+               rho_t[i] += rho_coeff_w*cos_w;
+               if (velocity)
+               {
+                  u_t[i] += rhoV1_coeff_w*cos_w;
+                  if constexpr(TDim > 1)
+                  {
+                     u_t[tile_size + i] += rhoV2_coeff_w*cos_w;
+                  }
+                  if constexpr(TDim > 2)
+                  {
+                     u_t[2*tile_size + i] += rhoV3_coeff_w*cos_w;
+                  }
+               }
+            }
+         }
+
+         const std::size_t pt_offset = r*row_size + begin;
+         StoreFieldsTile<TDim>(fields, nontemporal, variables,
+                              n, tile_size, base, rhoE_per_rho, rho_t, u_t,
+                              num_pts, rho + pt_offset, rhoV + pt_offset,
+                              rhoE + pt_offset);
+      }
+   }
+}
+
+template<std::size_t TDim>
+void ConvertVariablesKernel(const std::size_t num_pts, const double rho_bar,
+                              const double p_bar, const double *U_bar, 
+                              const double gamma, const Variables variables,
+                              double *__restrict__ rho,
+                              double *__restrict__ rhoV,
+                              double *__restrict__ rhoE)
+{
+   if (variables == Variables::Conservative)
+   {
+      return;
+   }
+   const BaseState base = MakeBaseState<TDim>(rho_bar, p_bar, U_bar, gamma);
+
+   DispatchVariables(variables, [&](const auto vars)
+   {
+      constexpr Variables kVariables = decltype(vars)::value;
+
+#ifdef JABBER_WITH_OPENMP
+      #pragma omp parallel for
+#endif // JABBER_WITH_OPENMP
+      for (std::size_t i = 0; i < num_pts; i++)
+      {
+         // Recover the primitive perturbations
+         double u[3];
+         double mag_u = 0.0;
+         for (std::size_t d = 0; d < TDim; d++)
+         {
+            u[d] = rhoV[d*num_pts + i]/rho[i];
+            mag_u += u[d]*u[d];
+         }
+         const double rhoE_p = rhoE[i] - 0.5*rho[i]*mag_u - base.rhoE;
+         for (std::size_t d = 0; d < TDim; d++)
+         {
+            u[d] -= U_bar[d];
+         }
+         StoreOutputs<TDim, kAllFields, kVariables, false>(base, 
+                                    rho[i] - rho_bar, rhoE_p, u, num_pts, 
+                                    rho + i, rhoV + i, rhoE + i);
+      }
+   });
+}
+
+void InterpolateSnapshotsKernel(const std::size_t num_vals, 
+                                 const int num_snaps,
+                                 const double *const *snapshots,
+                                 const double *weights,
+                                 double *__restrict__ out)
+{
+#ifdef JABBER_WITH_OPENMP
+   #pragma omp parallel for
+#endif // JABBER_WITH_OPENMP
+   for (std::size_t i = 0; i < num_vals; i++)
+   {
+      double sum = 0.0;
+      for (int s = 0; s < num_snaps; s++)
+      {
+         sum += weights[s]*snapshots[s][i];
+      }
+      out[i] = sum;
+   }
+}
+
+template void ComputeKernel<1, true>(const std::size_t, const double,
+                                 const double, const double *, 
+                                 const double, const int, const double,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const std::size_t,
+                                 const Accuracy,
+                                 const bool,
+                                 const FieldMask,
+                                 const Variables);
+                                
+template void ComputeKernel<2, true>(const std::size_t, const double,
+                                 const double, const double *, 
+                                 const double, const int, const double,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const std::size_t,
+                                 const Accuracy,
+                                 const bool,
+                                 const FieldMask,
+                                 const Variables);
+
+template void ComputeKernel<3, true>(const std::size_t, const double,
+                                 const double, const double *, 
+                                 const double, const int, const double,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const std::size_t,
+                                 const Accuracy,
+                                 const bool,
+                                 const FieldMask,
+                                 const Variables);
+
+template void ComputeKernel<1, false>(const std::size_t, const double,
+                                 const double, const double *, 
+                                 const double, const int, const double,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const std::size_t,
+                                 const Accuracy,
+                                 const bool,
+                                 const FieldMask,
+                                 const Variables);
+                                
+template void ComputeKernel<2, false>(const std::size_t, const double,
+                                 const double, const double *, 
+                                 const double, const int, const double,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const std::size_t,
+                                 const Accuracy,
+                                 const bool,
+                                 const FieldMask,
+                                 const Variables);
+
+template void ComputeKernel<3, false>(const std::size_t, const double,
+                                 const double, const double *, 
+                                 const double, const int, const double,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const std::size_t,
+                                 const Accuracy,
+                                 const bool,
+                                 const FieldMask,
+                                 const Variables);
+
+template void ComputeMixedKernel<1>(const std::size_t, const double,
+                                 const double, const double *,
+                                 const double, const int, const double,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const float *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const std::size_t, const FieldMask,
+                                 const Variables);
+
+template void ComputeMixedKernel<2>(const std::size_t, const double,
+                                 const double, const double *,
+                                 const double, const int, const double,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const float *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const std::size_t, const FieldMask,
+                                 const Variables);
+
+template void ComputeMixedKernel<3>(const std::size_t, const double,
+                                 const double, const double *,
+                                 const double, const int, const double,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const float *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const std::size_t, const FieldMask,
+                                 const Variables);
+
+template void ComputePhasorKernel<1>(const std::size_t, const double,
+                                 const double, const double *,
+                                 const double, const int,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
+
+template void ComputePhasorKernel<2>(const std::size_t, const double,
+                                 const double, const double *,
+                                 const double, const int,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
+
+template void ComputePhasorKernel<3>(const std::size_t, const double,
+                                 const double, const double *,
+                                 const double, const int,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
+
+template void ComputeGEMMKernel<1>(const std::size_t, const double,
+                                 const double, const double *,
+                                 const double, const int,
+                                 const std::size_t,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
+
+template void ComputeGEMMKernel<2>(const std::size_t, const double,
+                                 const double, const double *,
+                                 const double, const int,
+                                 const std::size_t,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
+
+template void ComputeGEMMKernel<3>(const std::size_t, const double,
+                                 const double, const double *,
+                                 const double, const int,
+                                 const std::size_t,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
+
+template void ComputeOnTheFlyKernel<1>(const std::size_t, const double,
+                                 const double, const double *,
+                                 const double, const int, const double,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
+
+template void ComputeOnTheFlyKernel<2>(const std::size_t, const double,
+                                 const double, const double *,
+                                 const double, const int, const double,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
+
+template void ComputeOnTheFlyKernel<3>(const std::size_t, const double,
+                                 const double, const double *,
+                                 const double, const int, const double,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
+
+template void ComputeUnrolledKernel<1>(const std::size_t, const double,
+                                 const double, const double *, 
+                                 const double, const int, const double,
+                                 const double *__restrict__, 
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const Accuracy, const FieldMask, 
+                                 const Variables);
+
+template void ComputeUnrolledKernel<2>(const std::size_t, const double,
+                                 const double, const double *, 
+                                 const double, const int, const double,
+                                 const double *__restrict__, 
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const Accuracy, const FieldMask, 
+                                 const Variables);
+
+template void ComputeUnrolledKernel<3>(const std::size_t, const double,
+                                 const double, const double *, 
+                                 const double, const int, const double,
+                                 const double *__restrict__, 
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const Accuracy, const FieldMask, 
+                                 const Variables);
+
+template void ComputeExpansionKernel<1>(const std::size_t, const double,
+                                 const double, const double *,
+                                 const double, const int, const double,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const std::size_t,
+                                 const std::size_t *__restrict__,
+                                 const std::size_t *__restrict__,
+                                 const double *__restrict__,
+                                 const int *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
+
+template void ComputeExpansionKernel<2>(const std::size_t, const double,
+                                 const double, const double *,
+                                 const double, const int, const double,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const std::size_t,
+                                 const std::size_t *__restrict__,
+                                 const std::size_t *__restrict__,
+                                 const double *__restrict__,
+                                 const int *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
+
+template void ComputeExpansionKernel<3>(const std::size_t, const double,
+                                 const double, const double *,
+                                 const double, const int, const double,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const std::size_t,
+                                 const std::size_t *__restrict__,
+                                 const std::size_t *__restrict__,
+                                 const double *__restrict__,
+                                 const int *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
+
+template void ComputeLowRankKernel<1>(const std::size_t, const double,
+                                 const double, const double *,
+                                 const double, const int, const double,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const int,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
+
+template void ComputeLowRankKernel<2>(const std::size_t, const double,
+                                 const double, const double *,
+                                 const double, const int, const double,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const int,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
+
+template void ComputeLowRankKernel<3>(const std::size_t, const double,
+                                 const double, const double *,
+                                 const double, const int, const double,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const int,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
+
+template void ComputeBandKernel<1>(const std::size_t, const int,
+                                 const double,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask);
+
+template void ComputeBandKernel<2>(const std::size_t, const int,
+                                 const double,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask);
+
+template void ComputeBandKernel<3>(const std::size_t, const int,
+                                 const double,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask);
 
-   if constexpr (TGridInnerLoop)
-   {
-      for (std::size_t i = 0; i < num_pts; i++)
-      {
-         rho[i] = rho_bar;
+template void ComputeMultiRateKernel<1>(const std::size_t, const double,
+                                 const double, const double *,
+                                 const double, const int,
+                                 const double *const *, const double *,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
 
-         rhoV[i] = U_bar[0];
-         if constexpr(TDim > 1)
-         {
-            rhoV[num_pts + i] = U_bar[1];
-         }
-         if constexpr(TDim > 2)
-         {
-            rhoV[2*num_pts + i] = U_bar[2];
-         }
-         rhoE[i] = rhoE_init;
-      }
+template void ComputeMultiRateKernel<2>(const std::size_t, const double,
+                                 const double, const double *,
+                                 const double, const int,
+                                 const double *const *, const double *,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
 
-      // Add contribution of each wave
-#ifdef JABBER_WITH_OPENMP
-      #pragma omp parallel for reduction(+:rho[0:num_pts],\
-                                          rhoV[0:num_pts*TDim],\
-                                          rhoE[0:num_pts])
-#endif // JABBER_WITH_OPENMP
-      for (int w = 0; w < num_waves; w++)
-      {
-         const double rho_coeff_w = rho_coeffs[w];
-         const double rhoV1_coeff_w = rhoV_coeffs[w];
-         const double rhoV2_coeff_w = TDim > 1 ? rhoV_coeffs[num_waves + w] : 0;
-         const double rhoV3_coeff_w = TDim > 2 ? rhoV_coeffs[2*num_waves + w] : 0;
-         const double rhoE_coeff_w = rhoE_coeffs[w];
-         const double omt = wave_omegas[w]*t;
+template void ComputeMultiRateKernel<3>(const std::size_t, const double,
+                                 const double, const double *,
+                                 const double, const int,
+                                 const double *const *, const double *,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
 
-         const std::size_t w_offset = w*num_pts;
+template void ComputeCollapsedKernel<1>(const std::size_t, const double,
+                                 const double, const double *, 
+                                 const double, const int,
+                                 const int *__restrict__,
+                                 const double *__restrict__,
+                                 const std::size_t *__restrict__,
+                                 const double *__restrict__,
+                                 const std::size_t *__restrict__,
+                                 const double,
+                                 const double *__restrict__, 
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const Accuracy, const FieldMask, 
+                                 const Variables);
 
-         for (std::size_t i = 0; i < num_pts; i++)
-         {
-            const double cos_w = std::cos(k_dot_x_p_phi[w_offset + i] - omt);
+template void ComputeCollapsedKernel<2>(const std::size_t, const double,
+                                 const double, const double *, 
+                                 const double, const int,
+                                 const int *__restrict__,
+                                 const double *__restrict__,
+                                 const std::size_t *__restrict__,
+                                 const double *__restrict__,
+                                 const std::size_t *__restrict__,
+                                 const double,
+                                 const double *__restrict__, 
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const Accuracy, const FieldMask, 
+                                 const Variables);
 
-            rho[i] += rho_coeff_w*cos_w;
-            rhoV[i] += rhoV1_coeff_w*cos_w;
-            if constexpr(TDim > 1)
-            {
-               rhoV[num_pts + i] += rhoV2_coeff_w*cos_w;
-            }
-            if constexpr(TDim > 2)
-            {
-               rhoV[2*num_pts + i] += rhoV3_coeff_w*cos_w;
-            }
-            rhoE[i] += rhoE_coeff_w*cos_w;
+template void ComputeCollapsedKernel<3>(const std::size_t, const double,
+                                 const double, const double *, 
+                                 const double, const int,
+                                 const int *__restrict__,
+                                 const double *__restrict__,
+                                 const std::size_t *__restrict__,
+                                 const double *__restrict__,
+                                 const std::size_t *__restrict__,
+                                 const double,
+                                 const double *__restrict__, 
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const Accuracy, const FieldMask, 
+                                 const Variables);
 
-         }
-      }
-   }
-   else
-   {
-#ifdef JABBER_WITH_OPENMP
-      #pragma omp parallel for
-#endif // JABBER_WITH_OPENMP
-      for (std::size_t i = 0; i < num_pts; i++)
-      {
-         double rho_i = rho_bar;
-         double rhoV1_i = U_bar[0];
-         double rhoV2_i = TDim > 1 ? U_bar[1] : 0.0;
-         double rhoV3_i = TDim > 2 ? U_bar[2] : 0.0;
-         double rhoE_i = rhoE_init;
+template void ComputeRecurrenceKernel<1>(const std::size_t, const double,
+                                 const double, const double *, 
+                                 const double, const int,
+                                 const int *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask,
+                                 const Variables);
 
-         const std::size_t i_offset = i*num_waves;
-         
-         for (int w = 0; w < num_waves; w++)
-         {
-            const double omt = wave_omegas[w]*t;
-            const double cos_w = std::cos(k_dot_x_p_phi[i_offset + w] - omt);
+template void ComputeRecurrenceKernel<2>(const std::size_t, const double,
+                                 const double, const double *, 
+                                 const double, const int,
+                                 const int *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask,
+                                 const Variables);
 
-            rho_i += rho_coeffs[w]*cos_w;
-            rhoV1_i += rhoV_coeffs[w]*cos_w;
-            if constexpr (TDim > 1)
-            {
-               rhoV2_i += rhoV_coeffs[num_waves + w]*cos_w;
-            }
-            if constexpr (TDim > 2)
-            {
-               rhoV3_i += rhoV_coeffs[2*num_waves + w]*cos_w;
-            }
-            rhoE_i += rhoE_coeffs[w]*cos_w;
-         }
-         rho[i] = rho_i;
-         rhoV[i] = rhoV1_i;
-         if constexpr (TDim > 1)
-         {
-            rhoV[num_pts + i] = rhoV2_i;
-         }
-         if constexpr (TDim > 2)
-         {
-            rhoV[2*num_pts + i] = rhoV3_i;
-         }
-         rhoE[i] = rhoE_i;
-      }
-   }
+template void ComputeRecurrenceKernel<3>(const std::size_t, const double,
+                                 const double, const double *, 
+                                 const double, const int,
+                                 const int *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask,
+                                 const Variables);
 
-   for (std::size_t i = 0; i < num_pts; i++)
-   {
-      double mag_u = 0.0;
-      
-      const double val0 = rhoV[i];
-      mag_u += val0*val0;
-      if constexpr (TDim > 1)
-      {
-         const double val1 = rhoV[num_pts + i];
-         mag_u += val1*val1;
-      }
-      if constexpr (TDim > 2)
-      {
-         const double val2 = rhoV[2*num_pts + i];
-         mag_u += val2*val2;
-      }
-      rhoE[i] += 0.5*rho[i]*mag_u;
-   }
-   
-   for (std::size_t i = 0; i < num_pts; i++)
-   {
-      rhoV[i] *= rho[i];
-      if constexpr (TDim > 1)
-      {
-         rhoV[num_pts + i] *= rho[i];
-      }
-      if constexpr (TDim > 2)
-      {
-         rhoV[2*num_pts + i] *= rho[i];
-      }
-   }
-}
+template void ComputeNUFFTKernel<1>(const std::size_t, const double,
+                                 const double, const double *,
+                                 const double, const int, const double,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 NUFFTPlan &,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
 
-// Explicit instantiation for Dims 1-3
-template void ComputeKernel<1, true>(const std::size_t, const double,
-                                 const double, const double *, 
+template void ComputeNUFFTKernel<2>(const std::size_t, const double,
+                                 const double, const double *,
                                  const double, const int, const double,
-                                 const double *__restrict__, 
                                  const double *__restrict__,
                                  const double *__restrict__,
                                  const double *__restrict__,
                                  const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 NUFFTPlan &,
                                  double *__restrict__,
                                  double *__restrict__,
-                                 double *__restrict__);
-                                
-template void ComputeKernel<2, true>(const std::size_t, const double,
-                                 const double, const double *, 
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
+
+template void ComputeNUFFTKernel<3>(const std::size_t, const double,
+                                 const double, const double *,
                                  const double, const int, const double,
-                                 const double *__restrict__, 
                                  const double *__restrict__,
                                  const double *__restrict__,
                                  const double *__restrict__,
                                  const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 NUFFTPlan &,
                                  double *__restrict__,
                                  double *__restrict__,
-                                 double *__restrict__);
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
 
-template void ComputeKernel<3, true>(const std::size_t, const double,
+template void ComputeSynthesisKernel<1>(const std::size_t, const double,
                                  const double, const double *, 
-                                 const double, const int, const double,
-                                 const double *__restrict__, 
+                                 const double, const int,
+                                 const int *__restrict__,
                                  const double *__restrict__,
+                                 const double,
                                  const double *__restrict__,
                                  const double *__restrict__,
                                  const double *__restrict__,
+                                 ProgressionFFTPlan *,
                                  double *__restrict__,
                                  double *__restrict__,
-                                 double *__restrict__);
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
 
-template void ComputeKernel<1, false>(const std::size_t, const double,
+template void ComputeSynthesisKernel<2>(const std::size_t, const double,
                                  const double, const double *, 
-                                 const double, const int, const double,
-                                 const double *__restrict__, 
+                                 const double, const int,
+                                 const int *__restrict__,
                                  const double *__restrict__,
+                                 const double,
                                  const double *__restrict__,
                                  const double *__restrict__,
                                  const double *__restrict__,
+                                 ProgressionFFTPlan *,
                                  double *__restrict__,
                                  double *__restrict__,
-                                 double *__restrict__);
-                                
-template void ComputeKernel<2, false>(const std::size_t, const double,
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
+
+template void ComputeSynthesisKernel<3>(const std::size_t, const double,
                                  const double, const double *, 
+                                 const double, const int,
+                                 const int *__restrict__,
+                                 const double *__restrict__,
+                                 const double,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 ProgressionFFTPlan *,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
+
+template void ComputeSIMDKernel<1>(const std::size_t, const double,
+                                 const double, const double *,
                                  const double, const int, const double,
-                                 const double *__restrict__, 
                                  const double *__restrict__,
                                  const double *__restrict__,
                                  const double *__restrict__,
                                  const double *__restrict__,
                                  double *__restrict__,
                                  double *__restrict__,
-                                 double *__restrict__);
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
 
-template void ComputeKernel<3, false>(const std::size_t, const double,
-                                 const double, const double *, 
+template void ComputeSIMDKernel<2>(const std::size_t, const double,
+                                 const double, const double *,
                                  const double, const int, const double,
-                                 const double *__restrict__, 
                                  const double *__restrict__,
                                  const double *__restrict__,
                                  const double *__restrict__,
                                  const double *__restrict__,
                                  double *__restrict__,
                                  double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
+
+template void ComputeSIMDKernel<3>(const std::size_t, const double,
+                                 const double, const double *,
+                                 const double, const int, const double,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
+
+template void ComputeStructuredKernel<1>(const std::size_t *, const double,
+                                 const double, const double *,
+                                 const double, const int,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
+
+template void ComputeStructuredKernel<2>(const std::size_t *, const double,
+                                 const double, const double *,
+                                 const double, const int,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
+
+template void ComputeStructuredKernel<3>(const std::size_t *, const double,
+                                 const double, const double *,
+                                 const double, const int,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 const double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 const FieldMask, const Variables);
+
+template void ConvertVariablesKernel<1>(const std::size_t, const double,
+                                 const double, const double *, 
+                                 const double, const Variables,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__);
+
+template void ConvertVariablesKernel<2>(const std::size_t, const double,
+                                 const double, const double *, 
+                                 const double, const Variables,
+                                 double *__restrict__,
+                                 double *__restrict__,
                                  double *__restrict__);
 
+template void ConvertVariablesKernel<3>(const std::size_t, const double,
+                                 const double, const double *, 
+                                 const double, const Variables,
+                                 double *__restrict__,
+                                 double *__restrict__,
+                                 double *__restrict__);
 
 } // namespace jabber
@@ -1,7 +1,10 @@
 #ifndef JABBER_KERNELS
 #define JABBER_KERNELS
 
+#include "nufft.hpp"
+
 #include <cstddef>
+#include <cstdint>
 
 namespace jabber
 {
@@ -13,6 +16,128 @@ namespace jabber
  */
    
 
+/**
+ * @brief Default number of points per tile in \ref ComputeKernel(). The
+ * accumulators of a tile in 3D then occupy 20 KiB, fitting within L1 cache.
+ */
+constexpr std::size_t kDefaultTileSize = 512;
+
+/**
+ * @brief Total output size in bytes above which \ref ComputeKernel() writes
+ * its output using non-temporal stores, as it would otherwise only evict
+ * data still in use from cache.
+ */
+constexpr std::size_t kNonTemporalStoreBytes = std::size_t(32) << 20;
+
+/**
+ * @brief Minimum number of waves per wave block of a deterministic 
+ * \ref ComputeKernel().
+ */
+constexpr int kDeterministicBlockWaves = 64;
+
+/**
+ * @brief Maximum number of wave blocks of a deterministic 
+ * \ref ComputeKernel(), bounding the partial sums held per tile.
+ */
+constexpr int kMaxDeterministicWaveBlocks = 8;
+
+/**
+ * @brief Maximum order of the Taylor expansion of \f$e^{i\vec{k}\cdot
+ * \vec{\delta}}\f$ in \ref ComputeExpansionKernel(). Tiles requiring a
+ * higher order are evaluated exactly.
+ */
+constexpr int kMaxExpansionOrder = 20;
+
+/**
+ * @brief Maximum number of waves for which \ref ComputeUnrolledKernel() is
+ * specialized.
+ */
+constexpr int kMaxUnrolledWaves = 16;
+
+/**
+ * @brief Accuracy of the cosine evaluation in \ref ComputeKernel().
+ * 
+ * @details Reduced accuracies use a range-reduced minimax polynomial 
+ * inlined into the kernel in place of `std::cos`, with the maximum absolute
+ * error of each cosine given below.
+ */
+enum class Accuracy : std::uint8_t
+{
+   /// Use `std::cos`.
+   Exact,
+
+   /// Absolute error below \f$10^{-10}\f$.
+   High,
+
+   /// Absolute error below \f$10^{-6}\f$.
+   Low,
+
+   /// Number of Accuracy enumerators.
+   Size
+};
+
+/// Conservative variable output by the kernels.
+enum class Field : std::uint8_t
+{
+   /// Density.
+   Density,
+
+   /// Momentum vector.
+   Momentum,
+
+   /// Energy.
+   Energy,
+
+   /// Number of Field enumerators.
+   Size
+};
+
+/// Set of Field enumerators, with bit `f` set for each Field `f`.
+using FieldMask = std::uint8_t;
+
+/// Get the FieldMask of only \p field.
+constexpr FieldMask FieldBit(const Field field)
+{
+   return FieldMask(1) << static_cast<int>(field);
+}
+
+/// Check if \p fields includes \p field.
+constexpr bool HasField(const FieldMask fields, const Field field)
+{
+   return (fields & FieldBit(field)) != 0;
+}
+
+/// FieldMask of all Field enumerators.
+constexpr FieldMask kAllFields = (FieldMask(1) << 
+                                    static_cast<int>(Field::Size)) - 1;
+
+/**
+ * @brief Form of the variables output by the kernels, each written to the
+ * density, momentum, and energy outputs respectively.
+ */
+enum class Variables : std::uint8_t
+{
+   /// Conservative variables \f$\rho\f$, \f$\rho\vec{u}\f$, \f$\rho E\f$.
+   Conservative,
+
+   /**
+    * @brief Primitive perturbations \f$\rho'\f$, \f$\vec{u}'\f$, 
+    * \f$p'\f$, excluding the base flow.
+    */
+   Primitive,
+
+   /**
+    * @brief Conservative perturbations linearized about the base flow, 
+    * \f$\rho'\f$, \f$(\rho\vec{u})'=\bar{\rho}\vec{u}'+\rho'\bar{\vec{U}}\f$,
+    * \f$(\rho E)'=p'/(\gamma-1)+\bar{\rho}\bar{\vec{U}}\cdot\vec{u}'+
+    * \frac{1}{2}\rho'|\bar{\vec{U}}|^2\f$.
+    */
+   Linearized,
+
+   /// Number of Variables enumerators.
+   Size
+};
+
 /**
    * @brief Kernel function for evaluating perturbed base flow, with series
    * summation inner loop/vectorization over each gridpoint.
@@ -25,6 +150,38 @@ namespace jabber
    * be stored in an SoA-format for contiguous memory accesses across hardware
    * threads.
    * 
+   * For \p TGridInnerLoop true, points are processed in tiles of
+   * \p tile_size, with the accumulators of each tile kept in cache across
+   * all waves. The conversion to conservative variables is then done in the
+   * same final pass that writes out each tile, using non-temporal stores if
+   * the output exceeds \ref kNonTemporalStoreBytes. Threads own disjoint
+   * tiles, so no OpenMP array reduction is required. If there are fewer
+   * tiles than threads, waves are additionally split into blocks, and the
+   * partial sums of each (tile, wave block) pair are combined pairwise per
+   * tile.
+   * 
+   * As the number of wave blocks then depends on the number of threads 
+   * and of points, so does the order of summation. If \p deterministic, 
+   * the number of wave blocks is instead a function of \p num_waves only 
+   * (see \ref kDeterministicBlockWaves), with each thread summing all wave
+   * blocks of its tiles if there are enough tiles. Each point is then 
+   * summed in the same order regardless of the number of threads or of the
+   * partition of the points, such as across MPI ranks, and so is
+   * bitwise reproducible.
+   * 
+   * Only the outputs in \p fields are written, with each combination of 
+   * \p fields specialized at compile time. If the momentum and energy are
+   * both excluded, the velocity is not summed at all. For \p variables 
+   * other than Variables::Conservative, the perturbations are written 
+   * directly without the base flow, such that they may be added to an 
+   * existing solution.
+   * 
+   * As the density and internal energy perturbations are both proportional
+   * to the pressure perturbation, only the density perturbation and the
+   * velocity are summed over the waves, with the internal energy derived
+   * from the density perturbation in the final pass. This reduces the 
+   * accumulators per point from 2 + \p TDim to 1 + \p TDim.
+   * 
    * All inner loops have been verified to be vectorized by Intel `icpx` 
    * 2025.3.1 using the flags `-O3 -xhost`. Proper vectorization by Intel
    * compilers can be checked via:
@@ -53,18 +210,27 @@ namespace jabber
    *                         \p num_waves.
    * @param rhoV_coeffs      \copybrief AcousticField::rhoV_coeffs Sized
    *                         \p TDim x \p num_waves.
-   * @param rhoE_coeffs      \copybrief AcousticField::rhoE_coeffs Sized
-   *                         \p num_waves.
    * @param wave_omegas      \copybrief AcousticField::wave_omegas Sized 
    *                         \p num_waves.
-   * @param k_dot_x_p_phi    \copybrief AcousticField::k_dot_x_p_phi Sized
-   *                         \p num_waves x \p num_points with ordering 
-   *                         [wave][point] for \p TGridInnerLoop true or
-   *                         [point][wave] for \p TGridInnerLoop false.
+   * @param k_dot_x_p_phi    \f$\vec{k}\cdot x+\phi\f$ of each wave at 
+   *                         each point. Sized \p num_waves x \p num_points
+   *                         with ordering [wave][point] for 
+   *                         \p TGridInnerLoop true or [point][wave] for 
+   *                         \p TGridInnerLoop false.
    * @param rho              Output flow density to compute, sized \p num_pts.
    * @param rhoV             Output flow momentum vector to compute, sized
    *                         \p TDim x \p num_pts with ordering [dim][point].
    * @param rhoE             Output flow energy to compute, sized \p num_pts.
+   * @param tile_size        Number of points per tile for \p TGridInnerLoop
+   *                         true. Unused otherwise.
+   * @param accuracy         Accuracy of the cosine evaluation.
+   * @param deterministic    Whether to sum in an order independent of the
+   *                         number of threads and of points for 
+   *                         \p TGridInnerLoop true. The order is always 
+   *                         independent otherwise.
+   * @param fields           Outputs to write, as a nonzero FieldMask. The 
+   *                         others are left unmodified.
+   * @param variables        Form of the output variables.
 */
 template<std::size_t TDim, bool TGridInnerLoop>
 void ComputeKernel(const std::size_t num_pts, const double rho_bar,
@@ -73,12 +239,819 @@ void ComputeKernel(const std::size_t num_pts, const double rho_bar,
                         const double t,
                         const double *__restrict__ rho_coeffs,
                         const double *__restrict__ rhoV_coeffs,
-                        const double *__restrict__ rhoE_coeffs, 
                         const double *__restrict__ wave_omegas,
                         const double *__restrict__ k_dot_x_p_phi,
                         double *__restrict__ rho,
                         double *__restrict__ rhoV,
-                        double *__restrict__ rhoE);
+                        double *__restrict__ rhoE,
+                        const std::size_t tile_size=kDefaultTileSize,
+                        const Accuracy accuracy=Accuracy::Exact,
+                        const bool deterministic=false,
+                        const FieldMask fields=kAllFields,
+                        const Variables variables=Variables::Conservative);
+
+/**
+   * @brief Mixed-precision equivalent of \ref ComputeKernel() with
+   * \p TGridInnerLoop true, accumulating the perturbations in single 
+   * precision.
+   * 
+   * @details As the perturbations are small relative to the base flow, 
+   * only the perturbations are evaluated and summed in single precision, 
+   * and are added to the base flow in double precision when each tile is
+   * written out. This halves the memory traffic of \p k_dot_x_p_phi and 
+   * doubles the vector width of the summation. 
+   * 
+   * To avoid losing the precision of the phase at large \p t, each 
+   * \f$\omega t\f$ is reduced to \f$[-\pi,\pi]\f$ in double precision 
+   * before being rounded, and \p k_dot_x_p_phi must likewise be reduced 
+   * prior to rounding. The absolute error of each perturbation is then 
+   * approximately \f$10^{-6}\f$ of the sum of its absolute coefficients,
+   * independent of \p t. Threads own disjoint tiles, and only the outputs
+   * in \p fields are written, as \p variables. Arguments not listed are 
+   * as in \ref ComputeKernel().
+   * 
+   * @param k_dot_x_p_phi    \f$\vec{k}\cdot x+\phi\f$ of each wave at 
+   *                         each point. Reduced to \f$[-\pi,\pi]\f$ and sized 
+   *                         \p num_waves x \p num_points with ordering 
+   *                         [wave][point].
+*/
+template<std::size_t TDim>
+void ComputeMixedKernel(const std::size_t num_pts, const double rho_bar,
+                        const double p_bar, const double *U_bar, 
+                        const double gamma, const int num_waves,
+                        const double t,
+                        const double *__restrict__ rho_coeffs,
+                        const double *__restrict__ rhoV_coeffs,
+                        const double *__restrict__ wave_omegas,
+                        const float *__restrict__ k_dot_x_p_phi,
+                        double *__restrict__ rho,
+                        double *__restrict__ rhoV,
+                        double *__restrict__ rhoE,
+                        const std::size_t tile_size=kDefaultTileSize,
+                        const FieldMask fields=kAllFields,
+                        const Variables variables=Variables::Conservative);
+
+/**
+   * @brief Kernel function for evaluating perturbed base flow from 
+   * precomputed spatial phasors, with series summation inner loop over each
+   * gridpoint.
+   * 
+   * @details Using \f$\cos(\vec{k}\cdot\vec{x}+\phi-\omega t)=
+   * \cos(\vec{k}\cdot\vec{x}+\phi)\cos(\omega t)+
+   * \sin(\vec{k}\cdot\vec{x}+\phi)\sin(\omega t)\f$, only one sine and
+   * cosine evaluation is required per wave, leaving the inner loop over
+   * \p num_pts free of transcendental function calls. This doubles the
+   * storage of the spatial term relative to \ref ComputeKernel().
+   * 
+   * The time-dependent phasors \p cos_omt and \p sin_omt are provided by
+   * the caller, so that they may either be evaluated directly at a time
+   * \f$t\f$ or advanced by recurrence (see \ref AcousticField::Advance()).
+   * Each tile of points is summed and then written once, with only the 
+   * outputs in \p fields written as \p variables, as in 
+   * \ref ComputeKernel().
+   * 
+   * @tparam TDim            Physical dimension.
+   * 
+   * @param num_pts          Number of physical points to evaluate at.
+   * @param rho_bar          Base flow density.
+   * @param p_bar            Base flow pressure.
+   * @param U_bar            Base flow velocity.
+   * @param gamma            Specific heat ratio.
+   * @param num_waves        Number of acoustic waves to compute.
+   * @param rho_coeffs       \copybrief AcousticField::rho_coeffs Sized
+   *                         \p num_waves.
+   * @param rhoV_coeffs      \copybrief AcousticField::rhoV_coeffs Sized
+   *                         \p TDim x \p num_waves.
+   * @param cos_omt          \f$\cos(\omega t)\f$ for each wave, sized
+   *                         \p num_waves.
+   * @param sin_omt          \f$\sin(\omega t)\f$ for each wave, sized
+   *                         \p num_waves.
+   * @param cos_k_dot_x_p_phi   \f$\cos(\vec{k}\cdot x+\phi)\f$ of each
+   *                            wave at each point. Sized \p num_waves x
+   *                            \p num_points with ordering [wave][point].
+   * @param sin_k_dot_x_p_phi   \f$\sin(\vec{k}\cdot x+\phi)\f$ of each
+   *                            wave at each point. Sized \p num_waves x
+   *                            \p num_points with ordering [wave][point].
+   * @param rho              Output flow density to compute, sized \p num_pts.
+   * @param rhoV             Output flow momentum vector to compute, sized
+   *                         \p TDim x \p num_pts with ordering [dim][point].
+   * @param rhoE             Output flow energy to compute, sized \p num_pts.
+   * @param fields           Outputs to write, as a nonzero FieldMask.
+   * @param variables        Form of the output variables.
+*/
+template<std::size_t TDim>
+void ComputePhasorKernel(const std::size_t num_pts, const double rho_bar,
+                        const double p_bar, const double *U_bar, 
+                        const double gamma, const int num_waves,
+                        const double *__restrict__ rho_coeffs,
+                        const double *__restrict__ rhoV_coeffs,
+                        const double *__restrict__ cos_omt,
+                        const double *__restrict__ sin_omt,
+                        const double *__restrict__ cos_k_dot_x_p_phi,
+                        const double *__restrict__ sin_k_dot_x_p_phi,
+                        double *__restrict__ rho,
+                        double *__restrict__ rhoV,
+                        double *__restrict__ rhoE,
+                        const FieldMask fields=kAllFields,
+                        const Variables variables=Variables::Conservative);
+
+/**
+   * @brief Kernel function for evaluating perturbed base flow on a 
+   * structured grid, from per-axis spatial phasors.
+   * 
+   * @details On a structured grid, 
+   * \f$e^{i(\vec{k}\cdot\vec{x}+\phi)}=e^{i(k_0x_0+\phi)}e^{ik_1x_1}
+   * e^{ik_2x_2}\f$, so only per-axis phasors need to be stored. For each
+   * row of points along the last axis, the time phasor and the phasors of
+   * the leading axes are combined once per wave, leaving a single complex
+   * multiply per point and wave. Rows are split into tiles, distributed
+   * across threads, and written out as in \ref ComputeKernel().
+   * 
+   * @tparam TDim            Physical dimension.
+   * 
+   * @param counts           Number of points along each axis, sized \p TDim.
+   *                         Points are ordered with the last axis varying
+   *                         fastest.
+   * @param rho_bar          Base flow density.
+   * @param p_bar            Base flow pressure.
+   * @param U_bar            Base flow velocity.
+   * @param gamma            Specific heat ratio.
+   * @param num_waves        Number of acoustic waves to compute.
+   * @param rho_coeffs       \copybrief AcousticField::rho_coeffs Sized
+   *                         \p num_waves.
+   * @param rhoV_coeffs      \copybrief AcousticField::rhoV_coeffs Sized
+   *                         \p TDim x \p num_waves.
+   * @param cos_omt          \f$\cos(\omega t)\f$ for each wave, sized
+   *                         \p num_waves.
+   * @param sin_omt          \f$\sin(\omega t)\f$ for each wave, sized
+   *                         \p num_waves.
+   * @param axis_cos_k_x     Per-axis spatial phasors \f$\cos(k_d x_d)\f$,
+   *                         with the wave phase in the first axis. Sized
+   *                         \p num_waves x sum of \p counts, with ordering
+   *                         [dim][wave][index along dim].
+   * @param axis_sin_k_x     Per-axis spatial phasors \f$\sin(k_d x_d)\f$,
+   *                         with the wave phase in the first axis. Sized
+   *                         \p num_waves x sum of \p counts, with ordering
+   *                         [dim][wave][index along dim].
+   * @param rho              Output flow density to compute, sized by the
+   *                         product of \p counts.
+   * @param rhoV             Output flow momentum vector to compute, sized
+   *                         \p TDim x number of points with ordering
+   *                         [dim][point].
+   * @param rhoE             Output flow energy to compute, sized by the
+   *                         product of \p counts.
+   * @param fields           Outputs to write, as a nonzero FieldMask.
+   * @param variables        Form of the output variables.
+*/
+template<std::size_t TDim>
+void ComputeStructuredKernel(const std::size_t *counts, const double rho_bar,
+                              const double p_bar, const double *U_bar, 
+                              const double gamma, const int num_waves,
+                              const double *__restrict__ rho_coeffs,
+                              const double *__restrict__ rhoV_coeffs,
+                                    const double *__restrict__ cos_omt,
+                              const double *__restrict__ sin_omt,
+                              const double *__restrict__ axis_cos_k_x,
+                              const double *__restrict__ axis_sin_k_x,
+                              double *__restrict__ rho,
+                              double *__restrict__ rhoV,
+                              double *__restrict__ rhoE,
+                              const FieldMask fields=kAllFields,
+                              const Variables variables=
+                                          Variables::Conservative);
+
+/**
+   * @brief Kernel function for evaluating perturbed base flow from 
+   * precomputed spatial phasors at multiple times, as a matrix product.
+   * 
+   * @details With the spatial phasors of \ref ComputePhasorKernel() as a 
+   * 2\p num_waves x \p num_pts matrix \f$B\f$, the summed perturbations
+   * of each series at each of the \p num_times times are the rows of 
+   * \f$AB\f$, where row \f$(t,q)\f$ of \f$A\f$ holds the coefficients of
+   * series \f$q\f$ scaled by \f$\cos(\omega t)\f$ and 
+   * \f$\sin(\omega t)\f$. The series are the density and, only if needed
+   * for \p fields, the \p TDim velocity components, with the energy 
+   * following from the density.
+   * 
+   * The product is evaluated with a blocked, register-tiled micro-kernel,
+   * such that each element of \f$B\f$ loaded from memory is reused for
+   * all series x \p num_times rows. Batching times thus raises the
+   * arithmetic intensity beyond that of \ref ComputePhasorKernel(). The 
+   * outputs in \p fields are written as \p variables per block of 
+   * points. Arguments not listed are as in \ref ComputePhasorKernel().
+   * 
+   * @param num_times        Number of times to evaluate at.
+   * @param times            Times to evaluate at, sized \p num_times.
+   * @param wave_omegas      \copybrief AcousticField::wave_omegas Sized 
+   *                         \p num_waves.
+   * @param rho              Output flow density to compute, sized 
+   *                         \p num_times x \p num_pts with ordering 
+   *                         [time][point].
+   * @param rhoV             Output flow momentum vector to compute, sized
+   *                         \p num_times x \p TDim x \p num_pts with 
+   *                         ordering [time][dim][point].
+   * @param rhoE             Output flow energy to compute, sized 
+   *                         \p num_times x \p num_pts with ordering 
+   *                         [time][point].
+*/
+template<std::size_t TDim>
+void ComputeGEMMKernel(const std::size_t num_pts, const double rho_bar,
+                        const double p_bar, const double *U_bar, 
+                        const double gamma, const int num_waves,
+                        const std::size_t num_times,
+                        const double *__restrict__ times,
+                        const double *__restrict__ rho_coeffs,
+                        const double *__restrict__ rhoV_coeffs,
+                        const double *__restrict__ wave_omegas,
+                        const double *__restrict__ cos_k_dot_x_p_phi,
+                        const double *__restrict__ sin_k_dot_x_p_phi,
+                        double *__restrict__ rho,
+                        double *__restrict__ rhoV,
+                        double *__restrict__ rhoE,
+                        const FieldMask fields=kAllFields,
+                        const Variables variables=Variables::Conservative);
+
+/**
+   * @brief Kernel function for evaluating perturbed base flow without any 
+   * precomputed \f$\vec{k}\cdot\vec{x}+\phi\f$, with series summation
+   * inner loop over each wave.
+   * 
+   * @details \f$\vec{k}\cdot\vec{x}+\phi\f$ is recomputed from 
+   * \p wave_ks, \p wave_phases, and \p coords at every call, trading a 
+   * modest increase in arithmetic for O(\p num_waves + \p num_pts) memory,
+   * rather than the O(\p num_waves x \p num_pts) of \ref ComputeKernel().
+   * Only the density perturbation and, if the momentum or energy is in 
+   * \p fields, the velocity are summed, as the energy perturbation is 
+   * proportional to the density perturbation. Only the outputs in 
+   * \p fields are then written, as \p variables.
+   * 
+   * @tparam TDim            Physical dimension.
+   * 
+   * @param num_pts          Number of physical points to evaluate at.
+   * @param rho_bar          Base flow density.
+   * @param p_bar            Base flow pressure.
+   * @param U_bar            Base flow velocity.
+   * @param gamma            Specific heat ratio.
+   * @param num_waves        Number of acoustic waves to compute.
+   * @param t                Time.
+   * @param rho_coeffs       \copybrief AcousticField::rho_coeffs Sized
+   *                         \p num_waves.
+   * @param rhoV_coeffs      \copybrief AcousticField::rhoV_coeffs Sized
+   *                         \p TDim x \p num_waves.
+   * @param wave_omegas      \copybrief AcousticField::wave_omegas Sized 
+   *                         \p num_waves.
+   * @param wave_ks          \copybrief AcousticField::wave_ks Sized 
+   *                         \p TDim x \p num_waves with ordering
+   *                         [dim][wave].
+   * @param wave_phases      \copybrief AcousticField::wave_phases Sized
+   *                         \p num_waves.
+   * @param coords           Coordinates to evaluate at, sized \p TDim x
+   *                         \p num_pts with ordering [dim][point].
+   * @param rho              Output flow density to compute, sized \p num_pts.
+   * @param rhoV             Output flow momentum vector to compute, sized
+   *                         \p TDim x \p num_pts with ordering [dim][point].
+   * @param rhoE             Output flow energy to compute, sized \p num_pts.
+   * @param fields           Outputs to write, as a nonzero FieldMask.
+   * @param variables        Form of the output variables.
+*/
+template<std::size_t TDim>
+void ComputeOnTheFlyKernel(const std::size_t num_pts, const double rho_bar,
+                        const double p_bar, const double *U_bar, 
+                        const double gamma, const int num_waves,
+                        const double t,
+                        const double *__restrict__ rho_coeffs,
+                        const double *__restrict__ rhoV_coeffs,
+                        const double *__restrict__ wave_omegas,
+                        const double *__restrict__ wave_ks,
+                        const double *__restrict__ wave_phases,
+                        const double *__restrict__ coords,
+                        double *__restrict__ rho,
+                        double *__restrict__ rhoV,
+                        double *__restrict__ rhoE,
+                        const FieldMask fields=kAllFields,
+                        const Variables variables=Variables::Conservative);
+
+/**
+   * @brief Kernel function for evaluating perturbed base flow of at most 
+   * \ref kMaxUnrolledWaves waves, with the series summation fully unrolled
+   * over the waves.
+   * 
+   * @details Internally, this dispatches to a specialization on 
+   * \p num_waves, such that all per-wave constants are held in registers
+   * and each point's sums are accumulated in registers. The time phases 
+   * \f$\phi-\omega t\f$ are formed once per call, and only the outputs in
+   * \p fields are written, once each, as \p variables. As with
+   * \ref ComputeOnTheFlyKernel(), no per-wave data at each point is needed.
+   * 
+   * @tparam TDim            Physical dimension.
+   * 
+   * @param num_pts          Number of physical points to evaluate at.
+   * @param rho_bar          Base flow density.
+   * @param p_bar            Base flow pressure.
+   * @param U_bar            Base flow velocity.
+   * @param gamma            Specific heat ratio.
+   * @param num_waves        Number of acoustic waves to compute, in 
+   *                         [1, \ref kMaxUnrolledWaves].
+   * @param t                Time.
+   * @param rho_coeffs       \copybrief AcousticField::rho_coeffs Sized
+   *                         \p num_waves.
+   * @param rhoV_coeffs      \copybrief AcousticField::rhoV_coeffs Sized
+   *                         \p TDim x \p num_waves.
+   * @param wave_omegas      \copybrief AcousticField::wave_omegas Sized 
+   *                         \p num_waves.
+   * @param wave_ks          \copybrief AcousticField::wave_ks Sized 
+   *                         \p TDim x \p num_waves with ordering
+   *                         [dim][wave].
+   * @param wave_phases      \copybrief AcousticField::wave_phases Sized
+   *                         \p num_waves.
+   * @param coords           Coordinates to evaluate at, sized \p TDim x
+   *                         \p num_pts with ordering [dim][point].
+   * @param rho              Output flow density to compute, sized \p num_pts.
+   * @param rhoV             Output flow momentum vector to compute, sized
+   *                         \p TDim x \p num_pts with ordering [dim][point].
+   * @param rhoE             Output flow energy to compute, sized \p num_pts.
+   * @param accuracy         Accuracy of the cosine evaluation.
+   * @param fields           Outputs to write, as a nonzero FieldMask.
+   * @param variables        Form of the output variables.
+*/
+template<std::size_t TDim>
+void ComputeUnrolledKernel(const std::size_t num_pts, const double rho_bar,
+                        const double p_bar, const double *U_bar, 
+                        const double gamma, const int num_waves,
+                        const double t,
+                        const double *__restrict__ rho_coeffs,
+                        const double *__restrict__ rhoV_coeffs,
+                        const double *__restrict__ wave_omegas,
+                        const double *__restrict__ wave_ks,
+                        const double *__restrict__ wave_phases,
+                        const double *__restrict__ coords,
+                        double *__restrict__ rho,
+                        double *__restrict__ rhoV,
+                        double *__restrict__ rhoE,
+                        const Accuracy accuracy=Accuracy::Exact,
+                        const FieldMask fields=kAllFields,
+                        const Variables variables=Variables::Conservative);
+
+/**
+   * @brief Kernel function for evaluating perturbed base flow with points
+   * binned into spatial tiles, factoring each wave's phasor about the tile
+   * center \f$\vec{x}_c\f$.
+   * 
+   * @details For a point \f$\vec{x}=\vec{x}_c+\vec{\delta}\f$ of a tile,
+   * \f$\cos(\theta_c+\psi)=\cos\theta_c C(\psi)-\sin\theta_c S(\psi)\f$
+   * with \f$\theta_c=\vec{k}\cdot\vec{x}_c+\phi-\omega t\f$ and 
+   * \f$\psi=\vec{k}\cdot\vec{\delta}\f$, where \f$C\f$ and \f$S\f$ are
+   * the Taylor expansions of \f$\cos\psi\f$ and \f$\sin\psi\f$ 
+   * truncated to the order of the tile. This costs one sincos pair per 
+   * wave and tile, plus a short polynomial per wave and point. Arguments 
+   * not listed are as in \ref ComputeOnTheFlyKernel().
+   * 
+   * @param num_tiles        Number of tiles.
+   * @param tile_offsets     Index of the first point of each tile in
+   *                         \p tile_pts, sized \p num_tiles + 1.
+   * @param tile_pts         Point indices, ordered by tile. Sized 
+   *                         \p num_pts.
+   * @param tile_centers     Center of each tile, sized \p num_tiles x 
+   *                         \p TDim with ordering [tile][dim].
+   * @param tile_orders      Expansion order of each tile, at most 
+   *                         \ref kMaxExpansionOrder, or -1 to evaluate the
+   *                         tile exactly. Sized \p num_tiles.
+   * @param tile_deltas      Offset \f$\vec{\delta}\f$ of each point from 
+   *                         its tile center, sized \p TDim x \p num_pts 
+   *                         with ordering [dim][point of \p tile_pts].
+*/
+template<std::size_t TDim>
+void ComputeExpansionKernel(const std::size_t num_pts, const double rho_bar,
+                        const double p_bar, const double *U_bar, 
+                        const double gamma, const int num_waves,
+                        const double t,
+                        const double *__restrict__ rho_coeffs,
+                        const double *__restrict__ rhoV_coeffs,
+                        const double *__restrict__ wave_omegas,
+                        const double *__restrict__ wave_ks,
+                        const double *__restrict__ wave_phases,
+                        const std::size_t num_tiles,
+                        const std::size_t *__restrict__ tile_offsets,
+                        const std::size_t *__restrict__ tile_pts,
+                        const double *__restrict__ tile_centers,
+                        const int *__restrict__ tile_orders,
+                        const double *__restrict__ tile_deltas,
+                        double *__restrict__ rho,
+                        double *__restrict__ rhoV,
+                        double *__restrict__ rhoE,
+                        const FieldMask fields=kAllFields,
+                        const Variables variables=Variables::Conservative);
+
+/**
+   * @brief Kernel function for evaluating perturbed base flow from a 
+   * low-rank factorization \f$M\approx QB\f$ of the matrix \f$M\f$ of 
+   * spatial phasors.
+   * 
+   * @details Row \f$w\f$ of \f$M\f$ holds 
+   * \f$\cos(\vec{k}\cdot\vec{x}+\phi)\f$ of wave \f$w\f$ at each point, 
+   * and row \f$w+\f$ \p num_waves holds \f$\sin(\vec{k}\cdot\vec{x}+\phi)\f$,
+   * such that each series is \f$a^T M\f$ with \f$a\f$ the coefficients 
+   * scaled by \f$\cos\omega t\f$ and \f$\sin\omega t\f$. Each series is
+   * instead evaluated as \f$(Q^T a)^T B\f$, costing O(\p rank x 
+   * (\p num_waves + \p num_pts)) rather than O(\p num_waves x 
+   * \p num_pts). Arguments not listed are as in 
+   * \ref ComputeOnTheFlyKernel().
+   * 
+   * @param rank             Rank of the factorization.
+   * @param basis            Orthonormal basis \f$Q\f$ of the rows of 
+   *                         \f$M\f$, sized 2 x \p num_waves x \p rank with
+   *                         ordering [row][rank].
+   * @param factors          Factor \f$B=Q^TM\f$, sized \p num_pts x 
+   *                         \p rank with ordering [point][rank].
+*/
+template<std::size_t TDim>
+void ComputeLowRankKernel(const std::size_t num_pts, const double rho_bar,
+                        const double p_bar, const double *U_bar, 
+                        const double gamma, const int num_waves,
+                        const double t,
+                        const double *__restrict__ rho_coeffs,
+                        const double *__restrict__ rhoV_coeffs,
+                        const double *__restrict__ wave_omegas,
+                        const int rank,
+                        const double *__restrict__ basis,
+                        const double *__restrict__ factors,
+                        double *__restrict__ rho,
+                        double *__restrict__ rhoV,
+                        double *__restrict__ rhoE,
+                        const FieldMask fields=kAllFields,
+                        const Variables variables=Variables::Conservative);
+
+/**
+   * @brief Kernel function for summing the perturbation series of a band 
+   * of waves and, optionally, their time derivatives, for 
+   * \ref ComputeMultiRateKernel().
+   * 
+   * @details The density and velocity perturbations, i.e. the series of
+   * \p rho_coeffs and \p rhoV_coeffs, are added to \p sums without any 
+   * base flow, and their time derivatives
+   * \f$\sum_j c_j\omega_j\sin(\vec{k}_j\cdot\vec{x}+\phi_j-\omega_j t)\f$
+   * to \p rates. The velocity series are only summed if the momentum or
+   * energy is in \p fields. Arguments not listed are as in 
+   * \ref ComputeOnTheFlyKernel().
+   * 
+   * @param sums             Perturbations to add to, sized (\p TDim + 1) x
+   *                         \p num_pts with ordering [series][point].
+   * @param rates            Time derivatives to add to, sized as \p sums, 
+   *                         or null to skip.
+*/
+template<std::size_t TDim>
+void ComputeBandKernel(const std::size_t num_pts, const int num_waves,
+                        const double t,
+                        const double *__restrict__ rho_coeffs,
+                        const double *__restrict__ rhoV_coeffs,
+                        const double *__restrict__ wave_omegas,
+                        const double *__restrict__ wave_ks,
+                        const double *__restrict__ wave_phases,
+                        const double *__restrict__ coords,
+                        double *__restrict__ sums,
+                        double *__restrict__ rates,
+                        const FieldMask fields=kAllFields);
+
+/**
+   * @brief Kernel function for evaluating perturbed base flow from a 
+   * weighted sum of perturbations of \ref ComputeBandKernel().
+   * 
+   * @details Each band of waves is either evaluated directly, or 
+   * interpolated in time between its perturbations and their derivatives 
+   * at two refresh times by cubic Hermite interpolation, such that the 
+   * field is the base flow plus the sum over \p num_terms of \p terms
+   * weighted by \p weights. Arguments not listed are as in 
+   * \ref ComputeOnTheFlyKernel().
+   * 
+   * @param num_terms        Number of terms to sum.
+   * @param terms            Pointer to each term, sized \p num_terms, each
+   *                         sized as `sums` of \ref ComputeBandKernel() 
+   *                         for \p fields.
+   * @param weights          Weight of each term, sized \p num_terms.
+*/
+template<std::size_t TDim>
+void ComputeMultiRateKernel(const std::size_t num_pts, const double rho_bar,
+                        const double p_bar, const double *U_bar, 
+                        const double gamma, const int num_terms,
+                        const double *const *terms,
+                        const double *weights,
+                        double *__restrict__ rho,
+                        double *__restrict__ rhoV,
+                        double *__restrict__ rhoE,
+                        const FieldMask fields=kAllFields,
+                        const Variables variables=Variables::Conservative);
+
+/**
+   * @brief Kernel function for evaluating perturbed base flow where waves
+   * are grouped by shared direction \f$\hat{k}_g\f$, such that each 
+   * group depends on \f$\vec{x}\f$ only through the projection 
+   * \f$s=\hat{k}_g\cdot\vec{x}\f$.
+   * 
+   * @details The sum over each group's waves is evaluated once per unique
+   * projection of the group, and then gathered to each point. For grids
+   * aligned with \f$\hat{k}_g\f$, this reduces the cost of a group from
+   * O(waves x \p num_pts) to O(waves x unique projections). Only the 
+   * outputs in \p fields are written as \p variables, as in 
+   * \ref ComputeKernel(), and the energy perturbation is derived from the
+   * density perturbation, as in \ref ComputeUnrolledKernel(). Arguments 
+   * not listed are as in \ref ComputeOnTheFlyKernel().
+   * 
+   * @param num_groups       Number of direction groups.
+   * @param group_offsets    Index of first wave of each group, sized 
+   *                         \p num_groups + 1. Waves of a group are 
+   *                         contiguous.
+   * @param group_k_hats     Direction of each group, sized \p num_groups x
+   *                         \p TDim with ordering [group][dim].
+   * @param proj_offsets     Index of first projection of each group in 
+   *                         \p projs, sized \p num_groups + 1.
+   * @param projs            Unique projections \f$s\f$ of each group.
+   * @param pt_proj_idxs     Index of the projection of each point within 
+   *                         its group, sized \p num_groups x \p num_pts 
+   *                         with ordering [group][point].
+   * @param rhoV_coeffs      Momentum series coefficients along the wave 
+   *                         direction, sized \p num_waves.
+   * @param wave_k_mags      Wavenumber of each wave along its direction,
+   *                         sized \p num_waves.
+   * @param proj_sums        Workspace, sized 2 x number of projections.
+   * @param accuracy         Accuracy of the cosine evaluation.
+   * @param fields           Outputs to write, as a nonzero FieldMask.
+   * @param variables        Form of the output variables.
+*/
+template<std::size_t TDim>
+void ComputeCollapsedKernel(const std::size_t num_pts, const double rho_bar,
+                        const double p_bar, const double *U_bar, 
+                        const double gamma, const int num_groups,
+                        const int *__restrict__ group_offsets,
+                        const double *__restrict__ group_k_hats,
+                        const std::size_t *__restrict__ proj_offsets,
+                        const double *__restrict__ projs,
+                        const std::size_t *__restrict__ pt_proj_idxs,
+                        const double t,
+                        const double *__restrict__ rho_coeffs,
+                        const double *__restrict__ rhoV_coeffs,
+                        const double *__restrict__ wave_omegas,
+                        const double *__restrict__ wave_k_mags,
+                        const double *__restrict__ wave_phases,
+                        double *__restrict__ proj_sums,
+                        double *__restrict__ rho,
+                        double *__restrict__ rhoV,
+                        double *__restrict__ rhoE,
+                        const Accuracy accuracy=Accuracy::Exact,
+                        const FieldMask fields=kAllFields,
+                        const Variables variables=Variables::Conservative);
+
+/**
+   * @brief Kernel function for evaluating perturbed base flow where waves
+   * form progressions, each sharing a direction \f$\hat{k}_p\f$ and 
+   * speed, with uniformly spaced frequencies (e.g. a uniformly discretized
+   * PSD source).
+   * 
+   * @details Within progression \f$p\f$, wave \f$j\f$ has 
+   * \f$\omega_j=\omega_0+j\Delta\omega\f$ and 
+   * \f$k_j=k_0+j\Delta k\f$, so that with \f$s=\hat{k}_p\cdot\vec{x}\f$
+   * its phase is \f$\alpha+j\beta+\phi_j\f$ for
+   * \f$\alpha=k_0s-\omega_0t\f$ and \f$\beta=\Delta ks-\Delta\omega t\f$.
+   * The sum over the progression is then evaluated as
+   * \f$\text{Re}(e^{i\alpha}\sum_jA_je^{i\phi_j}z^j)\f$ with 
+   * \f$z=e^{i\beta}\f$ by Horner's rule, costing one sincos pair per 
+   * point and progression rather than per wave. As all waves of a 
+   * progression share a direction and speed, their series coefficients 
+   * are the amplitude \f$A_j\f$ scaled by factors shared across the 
+   * progression, so only a single series is summed. Only the outputs in 
+   * \p fields are written as \p variables, as in \ref ComputeKernel(). 
+   * Arguments not listed are as in \ref ComputeOnTheFlyKernel().
+   * 
+   * @param num_progs        Number of progressions.
+   * @param prog_offsets     Index of first wave of each progression, sized 
+   *                         \p num_progs + 1. Waves of a progression are 
+   *                         contiguous and ordered by frequency.
+   * @param prog_k_hats      Direction of each progression, sized 
+   *                         \p num_progs x \p TDim with ordering 
+   *                         [progression][dim].
+   * @param prog_factors     Factors scaling \f$A_j\f$ to the density, 
+   *                         velocity, and energy series coefficients, sized
+   *                         \p num_progs x (2 + \p TDim) with ordering 
+   *                         [progression][series].
+   * @param prog_ks          \f$k_0\f$ and \f$\Delta k\f$ of each 
+   *                         progression, sized \p num_progs x 2.
+   * @param prog_omegas      \f$\omega_0\f$ and \f$\Delta\omega\f$ of each
+   *                         progression, sized \p num_progs x 2.
+   * @param amps_cos_phi     \f$A_j\cos\phi_j\f$ of each wave.
+   * @param amps_sin_phi     \f$A_j\sin\phi_j\f$ of each wave.
+   * @param fields           Outputs to write, as a nonzero FieldMask.
+   * @param variables        Form of the output variables.
+*/
+template<std::size_t TDim>
+void ComputeRecurrenceKernel(const std::size_t num_pts, const double rho_bar,
+                        const double p_bar, const double *U_bar, 
+                        const double gamma, const int num_progs,
+                        const int *__restrict__ prog_offsets,
+                        const double *__restrict__ prog_k_hats,
+                        const double *__restrict__ prog_factors,
+                        const double *__restrict__ prog_ks,
+                        const double *__restrict__ prog_omegas,
+                        const double t,
+                        const double *__restrict__ amps_cos_phi,
+                        const double *__restrict__ amps_sin_phi,
+                        const double *__restrict__ coords,
+                        double *__restrict__ rho,
+                        double *__restrict__ rhoV,
+                        double *__restrict__ rhoE,
+                        const FieldMask fields=kAllFields,
+                        const Variables variables=Variables::Conservative);
+
+/**
+   * @brief Kernel function for evaluating perturbed base flow via a 
+   * non-uniform FFT, accurate to a tolerance rather than to rounding.
+   * 
+   * @details The sum over waves of the density and, if the momentum or 
+   * energy is in \p fields, the velocity is evaluated by \p plan as 
+   * \f$\text{Re}\sum_j c_je^{i(\phi_j-\omega_jt)}e^{i\vec{k}_j\cdot\vec{x}}\f$,
+   * costing O((\p num_waves + \p num_pts)\f$P^d\f$ + \f$G\log G\f$) 
+   * rather than O(\p num_waves x \p num_pts). See \ref NUFFTPlan. 
+   * Arguments are as in \ref ComputeOnTheFlyKernel(), with the addition of:
+   * 
+   * @param plan             NUFFT plan, constructed from \p coords and
+   *                         \p wave_ks with 1 + \p TDim channels if the 
+   *                         velocity is summed, or 1 channel otherwise.
+*/
+template<std::size_t TDim>
+void ComputeNUFFTKernel(const std::size_t num_pts, const double rho_bar,
+                        const double p_bar, const double *U_bar, 
+                        const double gamma, const int num_waves,
+                        const double t,
+                        const double *__restrict__ rho_coeffs,
+                        const double *__restrict__ rhoV_coeffs,
+                        const double *__restrict__ wave_omegas,
+                        const double *__restrict__ wave_ks,
+                        const double *__restrict__ wave_phases,
+                        const double *__restrict__ coords,
+                        NUFFTPlan &plan,
+                        double *__restrict__ rho,
+                        double *__restrict__ rhoV,
+                        double *__restrict__ rhoE,
+                        const FieldMask fields=kAllFields,
+                        const Variables variables=Variables::Conservative);
+
+/**
+   * @brief Kernel function for evaluating perturbed base flow where waves
+   * form progressions as in \ref ComputeRecurrenceKernel(), via FFT
+   * synthesis accurate to a tolerance rather than to rounding.
+   *
+   * @details At fixed \f$t\f$, the sum over progression \f$p\f$ is
+   * \f$\text{Re}\sum_jA_je^{i(\phi_j-\omega_jt)}e^{ik_js}\f$ in the
+   * projected coordinate \f$s=\hat{k}_p\cdot\vec{x}\f$, which \p plans
+   * tabulate with one FFT and interpolate to each point. This costs
+   * O(\f$M\log M\f$ + \p num_pts \f$P\f$) per progression rather than
+   * O(\p num_waves x \p num_pts). See \ref ProgressionFFTPlan. Only the
+   * outputs in \p fields are written as \p variables, as in 
+   * \ref ComputeKernel(). Arguments not listed are as in 
+   * \ref ComputeRecurrenceKernel().
+   *
+   * @param wave_omegas      Angular frequency of each wave.
+   * @param plans            Plan of each progression, constructed from
+   *                         its projected coordinates, \f$k_0\f$, and
+   *                         \f$\Delta k\f$.
+*/
+template<std::size_t TDim>
+void ComputeSynthesisKernel(const std::size_t num_pts, const double rho_bar,
+                        const double p_bar, const double *U_bar,
+                        const double gamma, const int num_progs,
+                        const int *__restrict__ prog_offsets,
+                        const double *__restrict__ prog_factors,
+                        const double t,
+                        const double *__restrict__ wave_omegas,
+                        const double *__restrict__ amps_cos_phi,
+                        const double *__restrict__ amps_sin_phi,
+                        ProgressionFFTPlan *plans,
+                        double *__restrict__ rho,
+                        double *__restrict__ rhoV,
+                        double *__restrict__ rhoE,
+                        const FieldMask fields=kAllFields,
+                        const Variables variables=Variables::Conservative);
+
+/// Instruction sets that \ref ComputeSIMDKernel() may dispatch to.
+enum class InstructionSet : std::uint8_t
+{
+   /// SSE2 on x86-64, scalar otherwise.
+   Baseline,
+
+   /// AVX2 + FMA.
+   AVX2,
+
+   /// AVX-512F.
+   AVX512,
+
+   Size
+};
+
+/**
+ * @brief Get the instruction set used by \ref ComputeSIMDKernel(), which is
+ * the widest one supported by both the build and the running CPU. This is
+ * detected once on the first call.
+ */
+InstructionSet SIMDInstructionSet();
+
+/**
+   * @brief Kernel function for evaluating perturbed base flow, with series
+   * summation inner loop explicitly vectorized over each gridpoint.
+   * 
+   * @details Identical in inputs and outputs to \ref ComputeKernel() with
+   * `TGridInnerLoop=true`, but does not rely on compiler auto-vectorization
+   * or a vectorized math library for the cosine. Instead, it uses a
+   * polynomial cosine written with intrinsics, compiled separately for each
+   * instruction set in \ref InstructionSet and dispatched to at runtime via
+   * \ref SIMDInstructionSet(). Points are additionally split into tiles
+   * across threads so that no OpenMP array reduction is required, and only
+   * the outputs in \p fields of each tile are written, as \p variables.
+   * 
+   * @tparam TDim            Physical dimension.
+   * 
+   * @param num_pts          Number of physical points to evaluate at.
+   * @param rho_bar          Base flow density.
+   * @param p_bar            Base flow pressure.
+   * @param U_bar            Base flow velocity.
+   * @param gamma            Specific heat ratio.
+   * @param num_waves        Number of acoustic waves to compute.
+   * @param t                Time.
+   * @param rho_coeffs       \copybrief AcousticField::rho_coeffs Sized
+   *                         \p num_waves.
+   * @param rhoV_coeffs      \copybrief AcousticField::rhoV_coeffs Sized
+   *                         \p TDim x \p num_waves.
+   * @param wave_omegas      \copybrief AcousticField::wave_omegas Sized 
+   *                         \p num_waves.
+   * @param k_dot_x_p_phi    \f$\vec{k}\cdot x+\phi\f$ of each wave at 
+   *                         each point. Sized \p num_waves x \p num_points
+   *                         with ordering [wave][point].
+   * @param rho              Output flow density to compute, sized \p num_pts.
+   * @param rhoV             Output flow momentum vector to compute, sized
+   *                         \p TDim x \p num_pts with ordering [dim][point].
+   * @param rhoE             Output flow energy to compute, sized \p num_pts.
+   * @param fields           Outputs to write, as a nonzero FieldMask.
+   * @param variables        Form of the output variables.
+*/
+template<std::size_t TDim>
+void ComputeSIMDKernel(const std::size_t num_pts, const double rho_bar,
+                        const double p_bar, const double *U_bar, 
+                        const double gamma, const int num_waves,
+                        const double t,
+                        const double *__restrict__ rho_coeffs,
+                        const double *__restrict__ rhoV_coeffs,
+                        const double *__restrict__ wave_omegas,
+                        const double *__restrict__ k_dot_x_p_phi,
+                        double *__restrict__ rho,
+                        double *__restrict__ rhoV,
+                        double *__restrict__ rhoE,
+                        const FieldMask fields=kAllFields,
+                        const Variables variables=Variables::Conservative);
+
+/**
+   * @brief Kernel function for converting computed conservative variables
+   * in place to \p variables, for custom engines that only output the 
+   * conservative variables.
+   * 
+   * @details The primitive perturbations are recovered from the 
+   * conservative variables by subtracting the base flow, so are subject 
+   * to cancellation if small relative to it. All built-in kernels output 
+   * \p variables directly instead (see \ref ComputeKernel()).
+   * 
+   * @tparam TDim            Physical dimension.
+   * 
+   * @param num_pts          Number of points.
+   * @param rho_bar          Base flow density.
+   * @param p_bar            Base flow pressure.
+   * @param U_bar            Base flow velocity vector, sized \p TDim.
+   * @param gamma            Specific heat ratio.
+   * @param variables        Form of the variables to convert to.
+   * @param rho              Density to convert, sized \p num_pts.
+   * @param rhoV             Momentum vector to convert, sized \p TDim x 
+   *                         \p num_pts with ordering [dim][point].
+   * @param rhoE             Energy to convert, sized \p num_pts.
+*/
+template<std::size_t TDim>
+void ConvertVariablesKernel(const std::size_t num_pts, const double rho_bar,
+                              const double p_bar, const double *U_bar, 
+                              const double gamma, const Variables variables,
+                              double *__restrict__ rho,
+                              double *__restrict__ rhoV,
+                              double *__restrict__ rhoE);
+
+/**
+   * @brief Kernel function for interpolating precomputed snapshots of the 
+   * flowfield, as the weighted sum of \p num_snaps of them.
+   * 
+   * @param num_vals         Number of values per snapshot.
+   * @param num_snaps        Number of snapshots to sum.
+   * @param snapshots        Pointer to each snapshot, sized \p num_snaps, 
+   *                         each sized \p num_vals.
+   * @param weights          Weight of each snapshot, sized \p num_snaps.
+   * @param out              Output interpolated values, sized \p num_vals.
+*/
+void InterpolateSnapshotsKernel(const std::size_t num_vals, 
+                                 const int num_snaps,
+                                 const double *const *snapshots,
+                                 const double *weights,
+                                 double *__restrict__ out);
 
 /// @}
 // end of kernels_group
@@ -0,0 +1,130 @@
+#include "kernels.hpp"
+#include "kernels_simd.hpp"
+
+#include <cstdint>
+#include <bit>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif // __SSE2__
+
+namespace jabber
+{
+
+namespace simd
+{
+
+namespace
+{
+
+#ifdef __SSE2__
+
+/// SSE2 vector operations. SSE2 is always available on x86-64.
+struct Vec
+{
+   using type = __m128d;
+   using mask = __m128d;
+   static constexpr int kWidth = 2;
+
+   static type Load(const double *p) { return _mm_loadu_pd(p); }
+   static void Store(double *p, type a) { _mm_storeu_pd(p, a); }
+   static type Set1(double a) { return _mm_set1_pd(a); }
+   static type Add(type a, type b) { return _mm_add_pd(a, b); }
+   static type Sub(type a, type b) { return _mm_sub_pd(a, b); }
+   static type Mul(type a, type b) { return _mm_mul_pd(a, b); }
+   static type Fma(type a, type b, type c)
+   {
+      return _mm_add_pd(_mm_mul_pd(a, b), c);
+   }
+   static mask OddMask(type q_bits)
+   {
+      const __m128i one = _mm_set1_epi64x(1);
+      const __m128i odd = _mm_and_si128(_mm_castpd_si128(q_bits), one);
+      // No 64-bit compare in SSE2, so compare low halves and broadcast
+      const __m128i eq = _mm_cmpeq_epi32(odd, one);
+      return _mm_castsi128_pd(_mm_shuffle_epi32(eq, _MM_SHUFFLE(2,2,0,0)));
+   }
+   static type QuadrantSign(type q_bits)
+   {
+      __m128i q = _mm_add_epi64(_mm_castpd_si128(q_bits),
+                                 _mm_set1_epi64x(1));
+      q = _mm_and_si128(q, _mm_set1_epi64x(2));
+      return _mm_castsi128_pd(_mm_slli_epi64(q, 62));
+   }
+   static type Select(mask m, type a, type b)
+   {
+      return _mm_or_pd(_mm_and_pd(m, a), _mm_andnot_pd(m, b));
+   }
+   static type Xor(type a, type b) { return _mm_xor_pd(a, b); }
+   static bool AnyAbsGreater(type a, double b)
+   {
+      const type abs_a = _mm_andnot_pd(_mm_set1_pd(-0.0), a);
+      return _mm_movemask_pd(_mm_cmpgt_pd(abs_a, _mm_set1_pd(b))) != 0;
+   }
+};
+
+#else
+
+/// Scalar fallback operations, for targets without a vectorized baseline.
+struct Vec
+{
+   using type = double;
+   using mask = bool;
+   static constexpr int kWidth = 1;
+
+   static type Load(const double *p) { return *p; }
+   static void Store(double *p, type a) { *p = a; }
+   static type Set1(double a) { return a; }
+   static type Add(type a, type b) { return a + b; }
+   static type Sub(type a, type b) { return a - b; }
+   static type Mul(type a, type b) { return a*b; }
+   static type Fma(type a, type b, type c) { return a*b + c; }
+   static mask OddMask(type q_bits)
+   {
+      return std::bit_cast<std::uint64_t>(q_bits) & 1;
+   }
+   static type QuadrantSign(type q_bits)
+   {
+      const std::uint64_t q = std::bit_cast<std::uint64_t>(q_bits) + 1;
+      return std::bit_cast<double>((q & 2) << 62);
+   }
+   static type Select(mask m, type a, type b) { return m ? a : b; }
+   static type Xor(type a, type b)
+   {
+      return std::bit_cast<double>(std::bit_cast<std::uint64_t>(a) ^
+                                    std::bit_cast<std::uint64_t>(b));
+   }
+   static bool AnyAbsGreater(type a, double b) { return std::abs(a) > b; }
+};
+
+#endif // __SSE2__
+
+} // namespace
+
+JABBER_SIMD_DEFINE_ACCUMULATE(baseline, Vec)
+
+} // namespace simd
+
+InstructionSet SIMDInstructionSet()
+{
+#ifdef JABBER_WITH_X86_SIMD
+   static const InstructionSet isa = []()
+   {
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx512f"))
+      {
+         return InstructionSet::AVX512;
+      }
+      if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+      {
+         return InstructionSet::AVX2;
+      }
+      return InstructionSet::Baseline;
+   }();
+   return isa;
+#else
+   return InstructionSet::Baseline;
+#endif // JABBER_WITH_X86_SIMD
+}
+
+} // namespace jabber
@@ -0,0 +1,315 @@
+#ifndef JABBER_KERNELS_SIMD
+#define JABBER_KERNELS_SIMD
+
+/**
+ * @file kernels_simd.hpp
+ * @brief Internal header for the explicitly-vectorized kernels dispatched to
+ * by \ref jabber::ComputeSIMDKernel().
+ *
+ * @details Each instruction set is compiled in its own translation unit
+ * (kernels_simd.cpp, kernels_simd_avx2.cpp, kernels_simd_avx512.cpp) with the
+ * appropriate compiler flags. Each translation unit defines a `Vec` struct of
+ * static vector operations for its instruction set and instantiates the
+ * generic implementation below with it. The generic implementation is in an
+ * unnamed namespace, so that instantiations compiled with different
+ * instruction sets are never merged by the linker.
+ *
+ * This header is not installed.
+ */
+
+#include <cstddef>
+#include <cmath>
+#include <algorithm>
+
+namespace jabber
+{
+
+namespace simd
+{
+
+/// Declare the wave-accumulation entry point of an instruction set namespace.
+#define JABBER_SIMD_DECLARE_ACCUMULATE(isa)                                 \
+namespace isa                                                               \
+{                                                                           \
+template<std::size_t TDim>                                                  \
+void AccumulateWaves(const std::size_t num_pts,                             \
+                     const std::size_t tile_stride,                         \
+                     const int num_waves, const double t,                   \
+                     const double *__restrict__ rho_coeffs,                 \
+                     const double *__restrict__ rhoV_coeffs,                \
+                     const double *__restrict__ wave_omegas,                \
+                     const std::size_t stride,                              \
+                     const double *__restrict__ k_dot_x_p_phi,              \
+                     const bool velocity,                                   \
+                     double *__restrict__ rho_t,                            \
+                     double *__restrict__ u_t);                             \
+}
+
+JABBER_SIMD_DECLARE_ACCUMULATE(baseline)
+JABBER_SIMD_DECLARE_ACCUMULATE(avx2)
+JABBER_SIMD_DECLARE_ACCUMULATE(avx512)
+
+#undef JABBER_SIMD_DECLARE_ACCUMULATE
+
+namespace
+{
+
+/**
+ * @brief Largest |x| that \ref Cos() range-reduces itself. Beyond this, the
+ * 3-part Cody-Waite reduction is no longer exact and lanes are instead
+ * evaluated with `std::cos`.
+ */
+constexpr double kMaxReducibleArg = 1.0e6;
+
+/// 2/π.
+constexpr double kTwoOverPi = 6.36619772367581382433e-01;
+
+/// π/2 split into 33-bit parts, such that q*part is exact for |q| < 2^20.
+constexpr double kPiO2_1 = 1.57079632673412561417e+00;
+constexpr double kPiO2_2 = 6.07710050630396597660e-11;
+constexpr double kPiO2_3 = 2.02226624871116645580e-21;
+
+/**
+ * @brief 1.5*2^52. Adding this rounds to the nearest integer, which is then
+ * held in the low bits of the mantissa.
+ */
+constexpr double kShifter = 6755399441055744.0;
+
+/// Minimax polynomial coefficients for sin(r), |r| <= π/4 (from fdlibm).
+constexpr double kS1 = -1.66666666666666324348e-01;
+constexpr double kS2 =  8.33333333332248946124e-03;
+constexpr double kS3 = -1.98412698298579493134e-04;
+constexpr double kS4 =  2.75573137070700676789e-06;
+constexpr double kS5 = -2.50507602534068634195e-08;
+constexpr double kS6 =  1.58969099521155010221e-10;
+
+/// Minimax polynomial coefficients for cos(r), |r| <= π/4 (from fdlibm).
+constexpr double kC1 =  4.16666666666666019037e-02;
+constexpr double kC2 = -1.38888888888741095749e-03;
+constexpr double kC3 =  2.48015872894767294178e-05;
+constexpr double kC4 = -2.75573143513906633035e-07;
+constexpr double kC5 =  2.08757232129817482790e-09;
+constexpr double kC6 = -1.13596475577881948265e-11;
+
+/**
+ * @brief Vectorized cosine, accurate to ~1 ULP.
+ *
+ * @details The argument is reduced to r in [-π/4,π/4] with x = r + qπ/2,
+ * and cos(x) is then ±cos(r) or ±sin(r) depending on q mod 4.
+ */
+template<typename V>
+inline typename V::type Cos(typename V::type x)
+{
+   using T = typename V::type;
+
+   // Fall back to libm for arguments too large to reduce here
+   if (V::AnyAbsGreater(x, kMaxReducibleArg))
+   {
+      alignas(64) double lanes[V::kWidth];
+      V::Store(lanes, x);
+      for (int l = 0; l < V::kWidth; l++)
+      {
+         lanes[l] = std::cos(lanes[l]);
+      }
+      return V::Load(lanes);
+   }
+
+   // q = nearest integer to x*2/π, held in the low bits of q_bits
+   const T q_bits = V::Fma(x, V::Set1(kTwoOverPi), V::Set1(kShifter));
+   const T q = V::Sub(q_bits, V::Set1(kShifter));
+
+   // r = x - qπ/2
+   T r = V::Fma(q, V::Set1(-kPiO2_1), x);
+   r = V::Fma(q, V::Set1(-kPiO2_2), r);
+   r = V::Fma(q, V::Set1(-kPiO2_3), r);
+
+   const T z = V::Mul(r, r);
+
+   // sin(r)
+   T sin_p = V::Fma(z, V::Set1(kS6), V::Set1(kS5));
+   sin_p = V::Fma(z, sin_p, V::Set1(kS4));
+   sin_p = V::Fma(z, sin_p, V::Set1(kS3));
+   sin_p = V::Fma(z, sin_p, V::Set1(kS2));
+   sin_p = V::Fma(z, sin_p, V::Set1(kS1));
+   const T sin_r = V::Fma(V::Mul(z, r), sin_p, r);
+
+   // cos(r), with the 1-z/2 term compensated as in fdlibm
+   T cos_p = V::Fma(z, V::Set1(kC6), V::Set1(kC5));
+   cos_p = V::Fma(z, cos_p, V::Set1(kC4));
+   cos_p = V::Fma(z, cos_p, V::Set1(kC3));
+   cos_p = V::Fma(z, cos_p, V::Set1(kC2));
+   cos_p = V::Fma(z, cos_p, V::Set1(kC1));
+   const T hz = V::Mul(V::Set1(0.5), z);
+   const T one_m_hz = V::Sub(V::Set1(1.0), hz);
+   const T cos_r = V::Add(one_m_hz,
+                     V::Fma(V::Mul(z, z), cos_p,
+                        V::Sub(V::Sub(V::Set1(1.0), one_m_hz), hz)));
+
+   // Select + apply sign by quadrant
+   const T cos_x = V::Select(V::OddMask(q_bits), sin_r, cos_r);
+   return V::Xor(cos_x, V::QuadrantSign(q_bits));
+}
+
+/**
+ * @brief Generic wave accumulation into a single tile of \p num_pts 
+ * points, with the grid-point axis in the inner loop.
+ *
+ * @details Accumulates the density perturbation into \p rho_t and, if
+ * \p TVelocity, the velocity into \p u_t, whose components are spaced by
+ * \p tile_stride. The tile is small enough for its accumulators to remain
+ * in cache across all waves. \p k_dot_x_p_phi is offset to the first point
+ * of the tile, and has ordering [wave][point] with a stride of \p stride
+ * between waves.
+ */
+template<typename V, std::size_t TDim, bool TVelocity>
+void AccumulateWavesImpl(const std::size_t num_pts, 
+                           const std::size_t tile_stride,
+                           const int num_waves, const double t,
+                           const double *__restrict__ rho_coeffs,
+                           const double *__restrict__ rhoV_coeffs,
+                           const double *__restrict__ wave_omegas,
+                           const std::size_t stride,
+                           const double *__restrict__ k_dot_x_p_phi,
+                           double *__restrict__ rho_t,
+                           double *__restrict__ u_t)
+{
+   using T = typename V::type;
+
+   for (int w = 0; w < num_waves; w++)
+   {
+      const double rho_coeff_w = rho_coeffs[w];
+      const double rhoV1_coeff_w = TVelocity ? rhoV_coeffs[w] : 0;
+      const double rhoV2_coeff_w = TVelocity && TDim > 1 ?
+                                    rhoV_coeffs[num_waves + w] : 0;
+      const double rhoV3_coeff_w = TVelocity && TDim > 2 ?
+                                    rhoV_coeffs[2*num_waves + w] : 0;
+      const double omt = wave_omegas[w]*t;
+
+      const T rho_coeff_v = V::Set1(rho_coeff_w);
+      const T rhoV1_coeff_v = V::Set1(rhoV1_coeff_w);
+      const T rhoV2_coeff_v = V::Set1(rhoV2_coeff_w);
+      const T rhoV3_coeff_v = V::Set1(rhoV3_coeff_w);
+      const T omt_v = V::Set1(omt);
+
+      const double *kx_w = k_dot_x_p_phi + w*stride;
+
+      std::size_t i = 0;
+      for (; i + V::kWidth <= num_pts; i += V::kWidth)
+      {
+         const T cos_w = Cos<V>(V::Sub(V::Load(kx_w + i), omt_v));
+
+         V::Store(rho_t + i, 
+                  V::Fma(rho_coeff_v, cos_w, V::Load(rho_t + i)));
+         if constexpr (TVelocity)
+         {
+            V::Store(u_t + i,
+                     V::Fma(rhoV1_coeff_v, cos_w, V::Load(u_t + i)));
+            if constexpr (TDim > 1)
+            {
+               double *u2_t = u_t + tile_stride;
+               V::Store(u2_t + i,
+                        V::Fma(rhoV2_coeff_v, cos_w, V::Load(u2_t + i)));
+            }
+            if constexpr (TDim > 2)
+            {
+               double *u3_t = u_t + 2*tile_stride;
+               V::Store(u3_t + i,
+                        V::Fma(rhoV3_coeff_v, cos_w, V::Load(u3_t + i)));
+            }
+         }
+      }
+
+      // Remainder
+      for (; i < num_pts; i++)
+      {
+         const double cos_w = std::cos(kx_w[i] - omt);
+
+         rho_t[i] += rho_coeff_w*cos_w;
+         if constexpr (TVelocity)
+         {
+            u_t[i] += rhoV1_coeff_w*cos_w;
+            if constexpr(TDim > 1)
+            {
+               u_t[tile_stride + i] += rhoV2_coeff_w*cos_w;
+            }
+            if constexpr(TDim > 2)
+            {
+               u_t[2*tile_stride + i] += rhoV3_coeff_w*cos_w;
+            }
+         }
+      }
+   }
+}
+
+} // namespace
+
+/// Define + instantiate the wave-accumulation entry point for \p isa.
+#define JABBER_SIMD_DEFINE_ACCUMULATE(isa, Vec)                             \
+namespace isa                                                               \
+{                                                                           \
+template<std::size_t TDim>                                                  \
+void AccumulateWaves(const std::size_t num_pts,                             \
+                     const std::size_t tile_stride,                         \
+                     const int num_waves, const double t,                   \
+                     const double *__restrict__ rho_coeffs,                 \
+                     const double *__restrict__ rhoV_coeffs,                \
+                     const double *__restrict__ wave_omegas,                \
+                     const std::size_t stride,                              \
+                     const double *__restrict__ k_dot_x_p_phi,              \
+                     const bool velocity,                                   \
+                     double *__restrict__ rho_t,                            \
+                     double *__restrict__ u_t)                              \
+{                                                                           \
+   if (velocity)                                                            \
+   {                                                                        \
+      AccumulateWavesImpl<Vec, TDim, true>(num_pts, tile_stride, num_waves, \
+                                 t, rho_coeffs, rhoV_coeffs, wave_omegas,   \
+                                 stride, k_dot_x_p_phi, rho_t, u_t);        \
+   }                                                                        \
+   else                                                                     \
+   {                                                                        \
+      AccumulateWavesImpl<Vec, TDim, false>(num_pts, tile_stride, num_waves,\
+                                 t, rho_coeffs, rhoV_coeffs, wave_omegas,   \
+                                 stride, k_dot_x_p_phi, rho_t, u_t);        \
+   }                                                                        \
+}                                                                           \
+template void AccumulateWaves<1>(const std::size_t,                         \
+                                 const std::size_t, const int,              \
+                                 const double,                              \
+                                 const double *__restrict__,                \
+                                 const double *__restrict__,                \
+                                 const double *__restrict__,                \
+                                 const std::size_t,                         \
+                                 const double *__restrict__,                \
+                                 const bool,                                \
+                                 double *__restrict__,                      \
+                                 double *__restrict__);                     \
+template void AccumulateWaves<2>(const std::size_t,                         \
+                                 const std::size_t, const int,              \
+                                 const double,                              \
+                                 const double *__restrict__,                \
+                                 const double *__restrict__,                \
+                                 const double *__restrict__,                \
+                                 const std::size_t,                         \
+                                 const double *__restrict__,                \
+                                 const bool,                                \
+                                 double *__restrict__,                      \
+                                 double *__restrict__);                     \
+template void AccumulateWaves<3>(const std::size_t,                         \
+                                 const std::size_t, const int,              \
+                                 const double,                              \
+                                 const double *__restrict__,                \
+                                 const double *__restrict__,                \
+                                 const double *__restrict__,                \
+                                 const std::size_t,                         \
+                                 const double *__restrict__,                \
+                                 const bool,                                \
+                                 double *__restrict__,                      \
+                                 double *__restrict__);                     \
+}
+
+} // namespace simd
+
+} // namespace jabber
+
+#endif // JABBER_KERNELS_SIMD
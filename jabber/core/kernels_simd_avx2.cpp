@@ -0,0 +1,60 @@
+#include "kernels_simd.hpp"
+
+#include <immintrin.h>
+
+namespace jabber
+{
+
+namespace simd
+{
+
+namespace
+{
+
+/// AVX2 + FMA vector operations.
+struct Vec
+{
+   using type = __m256d;
+   using mask = __m256d;
+   static constexpr int kWidth = 4;
+
+   static type Load(const double *p) { return _mm256_loadu_pd(p); }
+   static void Store(double *p, type a) { _mm256_storeu_pd(p, a); }
+   static type Set1(double a) { return _mm256_set1_pd(a); }
+   static type Add(type a, type b) { return _mm256_add_pd(a, b); }
+   static type Sub(type a, type b) { return _mm256_sub_pd(a, b); }
+   static type Mul(type a, type b) { return _mm256_mul_pd(a, b); }
+   static type Fma(type a, type b, type c) { return _mm256_fmadd_pd(a, b, c); }
+   static mask OddMask(type q_bits)
+   {
+      const __m256i one = _mm256_set1_epi64x(1);
+      const __m256i odd = _mm256_and_si256(_mm256_castpd_si256(q_bits), one);
+      return _mm256_castsi256_pd(_mm256_cmpeq_epi64(odd, one));
+   }
+   static type QuadrantSign(type q_bits)
+   {
+      __m256i q = _mm256_add_epi64(_mm256_castpd_si256(q_bits),
+                                    _mm256_set1_epi64x(1));
+      q = _mm256_and_si256(q, _mm256_set1_epi64x(2));
+      return _mm256_castsi256_pd(_mm256_slli_epi64(q, 62));
+   }
+   static type Select(mask m, type a, type b)
+   {
+      return _mm256_blendv_pd(b, a, m);
+   }
+   static type Xor(type a, type b) { return _mm256_xor_pd(a, b); }
+   static bool AnyAbsGreater(type a, double b)
+   {
+      const type abs_a = _mm256_andnot_pd(_mm256_set1_pd(-0.0), a);
+      return _mm256_movemask_pd(_mm256_cmp_pd(abs_a, _mm256_set1_pd(b),
+                                                _CMP_GT_OQ)) != 0;
+   }
+};
+
+} // namespace
+
+JABBER_SIMD_DEFINE_ACCUMULATE(avx2, Vec)
+
+} // namespace simd
+
+} // namespace jabber
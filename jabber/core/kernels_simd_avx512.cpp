@@ -0,0 +1,66 @@
+#include "kernels_simd.hpp"
+
+#include <immintrin.h>
+
+namespace jabber
+{
+
+namespace simd
+{
+
+namespace
+{
+
+/**
+ * @brief AVX-512F vector operations. Bitwise operations are done in the
+ * integer domain, as the floating-point variants require AVX-512DQ.
+ */
+struct Vec
+{
+   using type = __m512d;
+   using mask = __mmask8;
+   static constexpr int kWidth = 8;
+
+   static type Load(const double *p) { return _mm512_loadu_pd(p); }
+   static void Store(double *p, type a) { _mm512_storeu_pd(p, a); }
+   static type Set1(double a) { return _mm512_set1_pd(a); }
+   static type Add(type a, type b) { return _mm512_add_pd(a, b); }
+   static type Sub(type a, type b) { return _mm512_sub_pd(a, b); }
+   static type Mul(type a, type b) { return _mm512_mul_pd(a, b); }
+   static type Fma(type a, type b, type c) { return _mm512_fmadd_pd(a, b, c); }
+   static mask OddMask(type q_bits)
+   {
+      return _mm512_test_epi64_mask(_mm512_castpd_si512(q_bits),
+                                    _mm512_set1_epi64(1));
+   }
+   static type QuadrantSign(type q_bits)
+   {
+      __m512i q = _mm512_add_epi64(_mm512_castpd_si512(q_bits),
+                                    _mm512_set1_epi64(1));
+      q = _mm512_and_si512(q, _mm512_set1_epi64(2));
+      // Zero-masked, as the unmasked shift reads an undefined vector
+      return _mm512_castsi512_pd(_mm512_maskz_slli_epi64(0xFF, q, 62));
+   }
+   static type Select(mask m, type a, type b)
+   {
+      return _mm512_mask_blend_pd(m, b, a);
+   }
+   static type Xor(type a, type b)
+   {
+      return _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(a),
+                                                   _mm512_castpd_si512(b)));
+   }
+   static bool AnyAbsGreater(type a, double b)
+   {
+      return _mm512_cmp_pd_mask(_mm512_abs_pd(a), _mm512_set1_pd(b),
+                                 _CMP_GT_OQ) != 0;
+   }
+};
+
+} // namespace
+
+JABBER_SIMD_DEFINE_ACCUMULATE(avx512, Vec)
+
+} // namespace simd
+
+} // namespace jabber
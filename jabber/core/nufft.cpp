@@ -0,0 +1,699 @@
+#include "nufft.hpp"
+
+#include <pocketfft_hdronly.h>
+
+#include <cmath>
+#include <numbers>
+#include <numeric>
+#include <algorithm>
+#include <stdexcept>
+
+#ifdef JABBER_WITH_OPENMP
+#include <omp.h>
+#endif // JABBER_WITH_OPENMP
+
+namespace jabber
+{
+
+namespace
+{
+
+/// Tolerances below this are clamped to it, being near double precision.
+constexpr double kMinTolerance = 1e-15;
+
+/// Maximum Gaussian half-width, for stack-allocated weights.
+constexpr int kMaxWidth = 48;
+
+/// Maximum size of the FFT grid workspace, in bytes.
+constexpr double kMaxGridBytes = double(std::size_t(1) << 32);
+
+/// Index \p i wrapped into [0, \p n).
+inline int Wrap(const int i, const int n)
+{
+   const int r = i % n;
+   return r < 0 ? r + n : r;
+}
+
+/**
+ * @brief Compute the Gaussian weights \f$e^{-(a+p\Delta)^2/4\tau}\f$ for
+ * \f$p\in[-P,P]\f$, using two exponentials and the precomputed factors
+ * \f$e^{-p^2\Delta^2/4\tau}\f$ in \p table (Greengard & Lee).
+ */
+inline void GaussianWeights(const double a, const double delta,
+                              const double tau, const int width,
+                              const double *table, double *w)
+{
+   const double e1 = std::exp(-a*a/(4*tau));
+   const double e2 = std::exp(-a*delta/(2*tau));
+   const double e2_inv = 1.0/e2;
+
+   w[width] = e1*table[width];
+   double f_p = e1, f_m = e1;
+   for (int p = 1; p <= width; p++)
+   {
+      f_p *= e2;
+      f_m *= e2_inv;
+      w[width+p] = f_p*table[width+p];
+      w[width-p] = f_m*table[width-p];
+   }
+}
+
+/// Fill \p table with \f$e^{-p^2\Delta^2/4\tau}\f$ for \f$p\in[-P,P]\f$.
+std::vector<double> GaussianTable(const double delta, const double tau,
+                                    const int width)
+{
+   std::vector<double> table(2*width+1);
+   for (int p = -width; p <= width; p++)
+   {
+      table[p+width] = std::exp(-p*p*delta*delta/(4*tau));
+   }
+   return table;
+}
+
+/// Maximum number of interpolation points in \ref ProgressionFFTPlan.
+constexpr int kMaxInterpPts = 16;
+
+/// Smallest FFT size \f$2^a3^b5^c\f$ that is at least \p n.
+std::size_t FFTSize(const std::size_t n)
+{
+   std::size_t best = std::size_t(1) << static_cast<int>(
+                                          std::ceil(std::log2(double(n))));
+   for (std::size_t f5 = 1; f5 < best; f5 *= 5)
+   {
+      for (std::size_t f35 = f5; f35 < best; f35 *= 3)
+      {
+         std::size_t size = f35;
+         while (size < n)
+         {
+            size *= 2;
+         }
+         best = std::min(best, size);
+      }
+   }
+   return best;
+}
+
+/**
+ * @brief Barycentric weights \f$(-1)^m\binom{P-1}{m}\f$ of \p num_pts
+ * equispaced interpolation points.
+ */
+std::vector<double> BarycentricWeights(const int num_pts)
+{
+   std::vector<double> weights(num_pts);
+   double binom = 1.0;
+   for (int m = 0; m < num_pts; m++)
+   {
+      weights[m] = (m % 2 == 0) ? binom : -binom;
+      binom = binom*(num_pts - 1 - m)/(m + 1);
+   }
+   return weights;
+}
+
+/**
+ * @brief Maximum error of interpolating \f$e^{i\theta x}\f$ from the
+ * integers \f$x=0,...,P-1\f$ with the barycentric \p weights, over the
+ * central interval \f$x\in[P/2-1,P/2]\f$.
+ */
+double LagrangeError(const std::vector<double> &weights, const double theta)
+{
+   constexpr int kNumSamples = 32;
+   const int P = weights.size();
+   double err = 0.0;
+   for (int l = 1; l < kNumSamples; l++)
+   {
+      const double x = P/2 - 1 + double(l)/kNumSamples;
+      std::complex<double> num = 0.0;
+      double den = 0.0;
+      for (int m = 0; m < P; m++)
+      {
+         const double w = weights[m]/(x - m);
+         num += w*std::polar(1.0, theta*m);
+         den += w;
+      }
+      err = std::max(err, std::abs(num/den - std::polar(1.0, theta*x)));
+   }
+   return err;
+}
+
+} // namespace
+
+NUFFTPlan::NUFFTPlan(int dim, std::size_t num_pts, const double *coords,
+                     int num_waves, const double *wave_ks,
+                     int num_channels, double tol)
+: dim_(dim), num_pts_(num_pts), num_waves_(num_waves),
+  num_channels_(num_channels), axes_(dim)
+{
+   if (dim < 1 || dim > 3)
+   {
+      throw std::invalid_argument("NUFFT dimension must be 1, 2, or 3.");
+   }
+   if (!(tol > 0.0 && tol < 1.0))
+   {
+      throw std::invalid_argument("NUFFT tolerance must be in (0,1).");
+   }
+   if (num_pts == 0 || num_waves == 0)
+   {
+      return;
+   }
+   tol = std::max(tol, kMinTolerance);
+
+   // Oversampling of the wavenumber domain (lambda) and of the FFT (sigma),
+   // trading grid size against Gaussian width and amplification of error
+   const double digits = -std::log10(tol);
+   const double lambda = 1.0 + std::sqrt(1.0 + digits);
+   const double sigma = 0.5 + std::sqrt(0.25 + 0.25*digits);
+
+   // Stage 1: Spreading to wavenumber grid
+   const double log_spread = std::log(1.0/tol);
+   double amp = 1.0;
+   for (int d = 0; d < dim; d++)
+   {
+      Axis &a = axes_[d];
+      const double *x_d = coords + d*num_pts;
+      const double *k_d = wave_ks + d*num_waves;
+
+      const auto [x_min, x_max] = std::minmax_element(x_d, x_d + num_pts);
+      const auto [k_min, k_max] = std::minmax_element(k_d, k_d + num_waves);
+      a.x_c = 0.5*(*x_min + *x_max);
+      a.s_c = 0.5*(*k_min + *k_max);
+      double X = 0.5*(*x_max - *x_min);
+      const double S = 0.5*(*k_max - *k_min);
+      if (X == 0.0)
+      {
+         X = 1.0;
+      }
+
+      const double L = lambda*X;
+      a.h = 2*std::numbers::pi/L;
+      a.tau = log_spread/(L*(L - 2*X));
+      a.spread_width = std::ceil(2*std::sqrt(a.tau*(log_spread + a.tau*X*X))
+                                    /a.h);
+      a.num_modes = std::ceil(S/a.h) + a.spread_width + 1;
+      amp *= std::exp(a.tau*X*X);
+   }
+
+   // Stage 2: Oversampled FFT from wavenumber grid to points, where error
+   // is amplified by the Gaussian factor of stage 1
+   const double log_interp = std::log(amp/tol);
+   double grid_size = 1.0;
+   bool fits = true;
+   for (int d = 0; d < dim; d++)
+   {
+      Axis &a = axes_[d];
+      const double K = a.num_modes;
+      a.fft_size = 2*static_cast<int>(std::ceil(0.5*sigma*(2*K + 1)));
+      const double M = a.fft_size;
+      a.tau_interp = log_interp/(M*(M - 2*K));
+      a.interp_width = std::ceil(M*std::sqrt(a.tau_interp*(log_interp +
+                                             a.tau_interp*K*K))
+                                    /std::numbers::pi);
+      grid_size *= M;
+      fits = fits && a.spread_width <= kMaxWidth &&
+               a.interp_width <= kMaxWidth &&
+               2*a.interp_width + 1 <= a.fft_size;
+   }
+
+   // Compare estimated cost (in flops) to that of the direct sum
+   double spread_pts = 1.0, interp_pts = 1.0;
+   for (const Axis &a : axes_)
+   {
+      spread_pts *= 2*a.spread_width + 1;
+      interp_pts *= 2*a.interp_width + 1;
+   }
+   const double W = num_waves, N = num_pts, C = num_channels;
+   const double direct_cost = W*N*(20.0 + 4.0*C);
+   const double fft_cost = W*spread_pts*(4.0*C + 1.0) +
+                           N*interp_pts*(4.0*C + 1.0) +
+                           5.0*C*grid_size*std::log2(grid_size);
+   use_fft_ = fits && fft_cost < direct_cost &&
+               C*grid_size*sizeof(std::complex<double>) <= kMaxGridBytes;
+   if (!use_fft_)
+   {
+      return;
+   }
+
+   for (Axis &a : axes_)
+   {
+      const int M = a.fft_size;
+      a.deconv.assign(M, 0.0);
+      for (int k = -a.num_modes; k <= a.num_modes; k++)
+      {
+         a.deconv[Wrap(k, M)] = std::sqrt(std::numbers::pi/a.tau_interp)*
+                                 std::exp(a.tau_interp*k*k);
+      }
+      a.spread_table = GaussianTable(a.h, a.tau, a.spread_width);
+      a.interp_table = GaussianTable(2*std::numbers::pi/M, a.tau_interp,
+                                       a.interp_width);
+   }
+
+   // Centering phase of each wave, and order by grid point along first axis
+   wave_factors_.resize(num_waves);
+   wave_order_.resize(num_waves);
+   wave_grid_idx_.resize(num_waves);
+   for (int j = 0; j < num_waves; j++)
+   {
+      double phase = 0.0;
+      for (int d = 0; d < dim; d++)
+      {
+         phase += (wave_ks[d*num_waves + j] - axes_[d].s_c)*axes_[d].x_c;
+      }
+      wave_factors_[j] = std::polar(1.0, phase);
+   }
+   std::iota(wave_order_.begin(), wave_order_.end(), 0);
+   const auto GridIdx = [&](const int j)
+   {
+      return static_cast<int>(std::lround((wave_ks[j] - axes_[0].s_c)
+                                             /axes_[0].h));
+   };
+   std::stable_sort(wave_order_.begin(), wave_order_.end(),
+                     [&](const int i, const int j)
+                     { return GridIdx(i) < GridIdx(j); });
+   for (int j = 0; j < num_waves; j++)
+   {
+      wave_grid_idx_[j] = GridIdx(wave_order_[j]);
+   }
+
+   // Phase, Gaussian deconvolution, and quadrature scaling of each point
+   point_factors_.resize(num_pts);
+   for (std::size_t i = 0; i < num_pts; i++)
+   {
+      double phase = 0.0, scale = 1.0;
+      for (int d = 0; d < dim; d++)
+      {
+         const Axis &a = axes_[d];
+         const double x = coords[d*num_pts + i];
+         const double x_p = x - a.x_c;
+         phase += a.s_c*x;
+         scale *= std::exp(a.tau*x_p*x_p)*a.h/
+                  (std::sqrt(4*std::numbers::pi*a.tau)*a.fft_size);
+      }
+      point_factors_[i] = std::polar(scale, phase);
+   }
+
+   grid_.resize(num_channels*GridSize());
+}
+
+std::size_t NUFFTPlan::GridSize() const
+{
+   std::size_t size = 1;
+   for (const Axis &a : axes_)
+   {
+      size *= a.fft_size;
+   }
+   return size;
+}
+
+template<std::size_t TDim>
+void NUFFTPlan::Spread(const double *wave_ks,
+                        const std::complex<double> *strengths)
+{
+   const std::size_t grid_size = GridSize();
+   const std::size_t row_size = grid_size/axes_[0].fft_size;
+   const int K0 = axes_[0].num_modes;
+   const int P0 = axes_[0].spread_width;
+
+   // Each block of rows along the first axis is spread to independently,
+   // from the contiguous range of sorted waves that overlap it
+   const int block_rows = 2*P0 + 1;
+   const int num_rows = 2*K0 + 1;
+   const int num_blocks = (num_rows + block_rows - 1)/block_rows;
+
+#ifdef JABBER_WITH_OPENMP
+   #pragma omp parallel for schedule(dynamic)
+#endif // JABBER_WITH_OPENMP
+   for (int b = 0; b < num_blocks; b++)
+   {
+      const int m_begin = -K0 + b*block_rows;
+      const int m_end = std::min(m_begin + block_rows, K0 + 1);
+      const auto first = std::lower_bound(wave_grid_idx_.begin(),
+                                          wave_grid_idx_.end(),
+                                          m_begin - P0);
+      const auto last = std::upper_bound(first, wave_grid_idx_.end(),
+                                          m_end - 1 + P0);
+
+      double w[TDim][2*kMaxWidth+1];
+      int idx[TDim][2*kMaxWidth+1];
+      for (auto it = first; it != last; it++)
+      {
+         const int j = wave_order_[it - wave_grid_idx_.begin()];
+         int m0[TDim];
+         for (std::size_t d = 0; d < TDim; d++)
+         {
+            const Axis &a = axes_[d];
+            const double s = wave_ks[d*num_waves_ + j] - a.s_c;
+            const int P = a.spread_width;
+            m0[d] = (d == 0) ? *it : std::lround(s/a.h);
+            GaussianWeights(m0[d]*a.h - s, a.h, a.tau, P,
+                              a.spread_table.data(), w[d]);
+            for (int p = 0; p <= 2*P; p++)
+            {
+               idx[d][p] = Wrap(m0[d] - P + p, a.fft_size);
+               w[d][p] *= a.deconv[idx[d][p]];
+            }
+         }
+
+         const int p0_begin = std::max(m_begin, m0[0] - P0) - (m0[0] - P0);
+         const int p0_end = std::min(m_end, m0[0] + P0 + 1) - (m0[0] - P0);
+         for (int q = 0; q < num_channels_; q++)
+         {
+            const std::complex<double> c = strengths[q*num_waves_ + j]*
+                                             wave_factors_[j];
+            std::complex<double> *grid_q = grid_.data() + q*grid_size;
+            for (int p0 = p0_begin; p0 < p0_end; p0++)
+            {
+               const std::complex<double> c0 = c*w[0][p0];
+               std::complex<double> *row = grid_q + idx[0][p0]*row_size;
+               if constexpr (TDim == 1)
+               {
+                  row[0] += c0;
+               }
+               else if constexpr (TDim == 2)
+               {
+                  for (int p1 = 0; p1 <= 2*axes_[1].spread_width; p1++)
+                  {
+                     row[idx[1][p1]] += c0*w[1][p1];
+                  }
+               }
+               else
+               {
+                  const std::size_t M2 = axes_[2].fft_size;
+                  for (int p1 = 0; p1 <= 2*axes_[1].spread_width; p1++)
+                  {
+                     const std::complex<double> c1 = c0*w[1][p1];
+                     std::complex<double> *row_1 = row + idx[1][p1]*M2;
+                     for (int p2 = 0; p2 <= 2*axes_[2].spread_width; p2++)
+                     {
+                        row_1[idx[2][p2]] += c1*w[2][p2];
+                     }
+                  }
+               }
+            }
+         }
+      }
+   }
+}
+
+template<std::size_t TDim>
+void NUFFTPlan::Interpolate(const double *coords, double *const *out) const
+{
+   const std::size_t grid_size = GridSize();
+   const std::size_t row_size = grid_size/axes_[0].fft_size;
+
+#ifdef JABBER_WITH_OPENMP
+   #pragma omp parallel for
+#endif // JABBER_WITH_OPENMP
+   for (std::size_t i = 0; i < num_pts_; i++)
+   {
+      double w[TDim][2*kMaxWidth+1];
+      int idx[TDim][2*kMaxWidth+1];
+      for (std::size_t d = 0; d < TDim; d++)
+      {
+         const Axis &a = axes_[d];
+         const int P = a.interp_width;
+         const double delta = 2*std::numbers::pi/a.fft_size;
+         const double theta = a.h*(coords[d*num_pts_ + i] - a.x_c);
+         const int l0 = std::lround(theta/delta);
+         GaussianWeights(l0*delta - theta, delta, a.tau_interp, P,
+                           a.interp_table.data(), w[d]);
+         for (int p = 0; p <= 2*P; p++)
+         {
+            idx[d][p] = Wrap(l0 - P + p, a.fft_size);
+         }
+      }
+
+      for (int q = 0; q < num_channels_; q++)
+      {
+         const std::complex<double> *grid_q = grid_.data() + q*grid_size;
+         std::complex<double> sum = 0.0;
+         for (int p0 = 0; p0 <= 2*axes_[0].interp_width; p0++)
+         {
+            const std::complex<double> *row = grid_q + idx[0][p0]*row_size;
+            std::complex<double> sum_0 = 0.0;
+            if constexpr (TDim == 1)
+            {
+               sum_0 = row[0];
+            }
+            else if constexpr (TDim == 2)
+            {
+               for (int p1 = 0; p1 <= 2*axes_[1].interp_width; p1++)
+               {
+                  sum_0 += row[idx[1][p1]]*w[1][p1];
+               }
+            }
+            else
+            {
+               const std::size_t M2 = axes_[2].fft_size;
+               for (int p1 = 0; p1 <= 2*axes_[1].interp_width; p1++)
+               {
+                  const std::complex<double> *row_1 = row + idx[1][p1]*M2;
+                  std::complex<double> sum_1 = 0.0;
+                  for (int p2 = 0; p2 <= 2*axes_[2].interp_width; p2++)
+                  {
+                     sum_1 += row_1[idx[2][p2]]*w[2][p2];
+                  }
+                  sum_0 += sum_1*w[1][p1];
+               }
+            }
+            sum += sum_0*w[0][p0];
+         }
+         out[q][i] = (point_factors_[i]*sum).real();
+      }
+   }
+}
+
+void NUFFTPlan::ExecuteDirect(const double *coords, const double *wave_ks,
+                              const std::complex<double> *strengths,
+                              double *const *out) const
+{
+#ifdef JABBER_WITH_OPENMP
+   #pragma omp parallel
+#endif // JABBER_WITH_OPENMP
+   {
+      std::vector<double> sum(num_channels_);
+
+#ifdef JABBER_WITH_OPENMP
+      #pragma omp for
+#endif // JABBER_WITH_OPENMP
+      for (std::size_t i = 0; i < num_pts_; i++)
+      {
+         std::fill(sum.begin(), sum.end(), 0.0);
+         for (int j = 0; j < num_waves_; j++)
+         {
+            double phase = 0.0;
+            for (int d = 0; d < dim_; d++)
+            {
+               phase += wave_ks[d*num_waves_ + j]*coords[d*num_pts_ + i];
+            }
+            const double cos_p = std::cos(phase), sin_p = std::sin(phase);
+            for (int q = 0; q < num_channels_; q++)
+            {
+               const std::complex<double> &c = strengths[q*num_waves_ + j];
+               sum[q] += c.real()*cos_p - c.imag()*sin_p;
+            }
+         }
+         for (int q = 0; q < num_channels_; q++)
+         {
+            out[q][i] = sum[q];
+         }
+      }
+   }
+}
+
+void NUFFTPlan::Execute(const double *coords, const double *wave_ks,
+                        const std::complex<double> *strengths,
+                        double *const *out)
+{
+   if (!use_fft_)
+   {
+      ExecuteDirect(coords, wave_ks, strengths, out);
+      return;
+   }
+
+   std::fill(grid_.begin(), grid_.end(), std::complex<double>(0.0));
+   switch (dim_)
+   {
+      case 1: Spread<1>(wave_ks, strengths); break;
+      case 2: Spread<2>(wave_ks, strengths); break;
+      case 3: Spread<3>(wave_ks, strengths); break;
+   }
+
+   pocketfft::shape_t shape(dim_ + 1), axes(dim_);
+   pocketfft::stride_t stride(dim_ + 1);
+   shape[0] = num_channels_;
+   for (int d = 0; d < dim_; d++)
+   {
+      shape[d+1] = axes_[d].fft_size;
+   }
+   stride[dim_] = sizeof(std::complex<double>);
+   for (int d = dim_; d > 0; d--)
+   {
+      stride[d-1] = stride[d]*shape[d];
+   }
+   std::iota(axes.begin(), axes.end(), 1);
+#ifdef JABBER_WITH_OPENMP
+   const std::size_t num_threads = omp_get_max_threads();
+#else
+   const std::size_t num_threads = 1;
+#endif // JABBER_WITH_OPENMP
+   pocketfft::c2c(shape, stride, stride, axes, pocketfft::BACKWARD,
+                  grid_.data(), grid_.data(), 1.0, num_threads);
+
+   switch (dim_)
+   {
+      case 1: Interpolate<1>(coords, out); break;
+      case 2: Interpolate<2>(coords, out); break;
+      case 3: Interpolate<3>(coords, out); break;
+   }
+}
+
+ProgressionFFTPlan::ProgressionFFTPlan(std::size_t num_pts,
+                                       const double *projs, int num_waves,
+                                       double k0, double dk, double tol)
+: num_pts_(num_pts), num_waves_(num_waves)
+{
+   if (!(tol > 0.0 && tol < 1.0))
+   {
+      throw std::invalid_argument("FFT synthesis tolerance must be in (0,1).");
+   }
+   if (dk == 0.0)
+   {
+      throw std::invalid_argument("Wavenumber spacing must be nonzero.");
+   }
+   if (num_pts == 0 || num_waves == 0)
+   {
+      return;
+   }
+   tol = std::max(tol, kMinTolerance);
+
+   // For each number of interpolation points, the largest table phase step
+   // of the envelope's highest wavenumber that meets the tolerance sets the
+   // table size. Take that of least estimated cost (in flops).
+   const int center = num_waves/2;
+   const double W = num_waves, N = num_pts;
+   double best_cost = W*N*8.0;
+   for (int P = 2; P <= kMaxInterpPts; P += 2)
+   {
+      const std::vector<double> weights = BarycentricWeights(P);
+      double theta_lo = 0.0, theta_hi = std::numbers::pi;
+      if (LagrangeError(weights, theta_hi) > tol)
+      {
+         for (int iter = 0; iter < 50; iter++)
+         {
+            const double theta = 0.5*(theta_lo + theta_hi);
+            if (LagrangeError(weights, theta) > tol)
+            {
+               theta_hi = theta;
+            }
+            else
+            {
+               theta_lo = theta;
+            }
+         }
+         if (theta_lo == 0.0)
+         {
+            continue;
+         }
+      }
+      else
+      {
+         theta_lo = theta_hi;
+      }
+
+      const double min_size = std::max({W, double(P),
+                                       std::ceil(2*std::numbers::pi*center
+                                                   /theta_lo)});
+      if (min_size*sizeof(std::complex<double>) > kMaxGridBytes)
+      {
+         continue;
+      }
+      const double M = FFTSize(min_size);
+      const double cost = 5.0*M*std::log2(M) + N*(14.0*P + 20.0);
+      if (cost < best_cost)
+      {
+         best_cost = cost;
+         fft_size_ = M;
+         interp_pts_ = P;
+      }
+   }
+   use_fft_ = interp_pts_ > 0;
+   if (!use_fft_)
+   {
+      return;
+   }
+
+   // Table point preceding each point, and its carrier. The envelope is
+   // tabulated in s*sgn(Δk), so that negative spacings are also handled.
+   const int M = fft_size_;
+   const double h = std::copysign(2*std::numbers::pi/(M*std::abs(dk)), dk);
+   const double k_c = k0 + center*dk;
+   bary_weights_ = BarycentricWeights(interp_pts_);
+   base_idx_.resize(num_pts);
+   offsets_.resize(num_pts);
+   carriers_.resize(num_pts);
+   for (std::size_t i = 0; i < num_pts; i++)
+   {
+      const double u = projs[i]/h;
+      const double u_wrap = u - M*std::floor(u/M);
+      const int i0 = std::min(static_cast<int>(u_wrap), M - 1);
+      base_idx_[i] = Wrap(i0 - (interp_pts_/2 - 1), M);
+      offsets_[i] = u_wrap - i0;
+      carriers_[i] = std::polar(1.0, k_c*projs[i]);
+   }
+
+   table_.resize(M);
+}
+
+void ProgressionFFTPlan::Execute(const std::complex<double> *strengths,
+                                 double *out)
+{
+   if (!use_fft_)
+   {
+      throw std::logic_error("ProgressionFFTPlan is not executable.");
+   }
+
+   // Tabulate envelope over one period
+   const int M = fft_size_;
+   const int center = num_waves_/2;
+   std::fill(table_.begin(), table_.end(), std::complex<double>(0.0));
+   for (int j = 0; j < num_waves_; j++)
+   {
+      table_[Wrap(j - center, M)] = strengths[j];
+   }
+   pocketfft::c2c({std::size_t(M)}, {sizeof(std::complex<double>)},
+                  {sizeof(std::complex<double>)}, {0}, pocketfft::BACKWARD,
+                  table_.data(), table_.data(), 1.0);
+
+   // Interpolate + apply carrier
+   const int P = interp_pts_;
+   const double *weights = bary_weights_.data();
+   const std::complex<double> *table = table_.data();
+#ifdef JABBER_WITH_OPENMP
+   #pragma omp parallel for
+#endif // JABBER_WITH_OPENMP
+   for (std::size_t i = 0; i < num_pts_; i++)
+   {
+      const int base = base_idx_[i];
+      const double x = offsets_[i] + (P/2 - 1);
+      std::complex<double> val;
+      if (offsets_[i] == 0.0)
+      {
+         val = table[(base + P/2 - 1) % M];
+      }
+      else
+      {
+         std::complex<double> num = 0.0;
+         double den = 0.0;
+         for (int m = 0; m < P; m++)
+         {
+            const int idx = base + m;
+            const double w = weights[m]/(x - m);
+            num += w*table[idx < M ? idx : idx - M];
+            den += w;
+         }
+         val = num/den;
+      }
+      out[i] = (carriers_[i]*val).real();
+   }
+}
+
+} // namespace jabber
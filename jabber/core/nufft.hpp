@@ -0,0 +1,283 @@
+#ifndef JABBER_NUFFT
+#define JABBER_NUFFT
+
+#include <vector>
+#include <complex>
+#include <cstddef>
+
+namespace jabber
+{
+
+/**
+ * @brief Plan for evaluating sums of the form
+ * \f$f_q(\vec{x}_i)=\text{Re}\sum_j c_{qj}e^{i\vec{k}_j\cdot\vec{x}_i}\f$
+ * for fixed non-uniform points \f$\vec{x}_i\f$ and wavenumbers
+ * \f$\vec{k}_j\f$, with strengths \f$c_{qj}\f$ for each channel \f$q\f$
+ * that may change between evaluations.
+ *
+ * @details This is a type-3 non-uniform FFT, evaluated using Gaussian
+ * gridding in two stages (Greengard & Lee, SIAM Review 2004):
+ *
+ * 1. The strengths are spread onto a uniform wavenumber grid with a
+ *    Gaussian, such that \f$f\f$ is the inverse Fourier transform of the
+ *    gridded data up to a known Gaussian factor in \f$\vec{x}\f$.
+ * 2. The uniform-to-non-uniform inverse transform is done by deconvolving,
+ *    taking an oversampled FFT, and interpolating to each
+ *    \f$\vec{x}_i\f$ with a second Gaussian.
+ *
+ * This costs O(\f$(W + N)P^d + G\log G\f$) per evaluation, for \f$W\f$
+ * wavenumbers, \f$N\f$ points, Gaussian widths \f$P\f$ set by the
+ * tolerance, and FFT grid size \f$G\f$ set by the product of the extents
+ * of the points and wavenumbers. Where this is estimated to exceed the
+ * O(\f$WN\f$) direct sum, the direct sum is evaluated instead.
+ *
+ * The error of each \f$f_q\f$ is bounded by approximately the tolerance
+ * times \f$\sum_j|c_{qj}|\f$.
+ */
+class NUFFTPlan
+{
+private:
+
+   /// Gridding parameters of a single axis.
+   struct Axis
+   {
+      /// Center of points.
+      double x_c;
+
+      /// Center of wavenumbers.
+      double s_c;
+
+      /// Spacing of the uniform wavenumber grid.
+      double h;
+
+      /// Width parameter of the spreading Gaussian, \f$e^{-s^2/4\tau}\f$.
+      double tau;
+
+      /// Half-width of spreading Gaussian, in wavenumber grid points.
+      int spread_width;
+
+      /// Half-width of the uniform wavenumber grid, in grid points.
+      int num_modes;
+
+      /// Size of the oversampled FFT.
+      int fft_size;
+
+      /// Width parameter of the interpolating Gaussian.
+      double tau_interp;
+
+      /// Half-width of the interpolating Gaussian, in FFT grid points.
+      int interp_width;
+
+      /**
+       * @brief Deconvolution factor for each FFT index, zero outside of
+       * the wavenumber grid. Sized \ref fft_size.
+       */
+      std::vector<double> deconv;
+
+      /**
+       * @brief Factors \f$e^{-p^2h^2/4\tau}\f$ of the spreading Gaussian
+       * for each offset \f$p\f$. Sized 2 x \ref spread_width + 1.
+       */
+      std::vector<double> spread_table;
+
+      /// Equivalent of \ref spread_table for the interpolating Gaussian.
+      std::vector<double> interp_table;
+   };
+
+   /// Spatial dimension.
+   int dim_ = 0;
+
+   /// Number of points.
+   std::size_t num_pts_ = 0;
+
+   /// Number of wavenumbers.
+   int num_waves_ = 0;
+
+   /// Number of channels.
+   int num_channels_ = 0;
+
+   /// If false, the direct sum is evaluated.
+   bool use_fft_ = false;
+
+   /// Gridding parameters for each axis.
+   std::vector<Axis> axes_;
+
+   /**
+    * @brief Phase factor \f$e^{i(\vec{k}_j-\vec{s}_c)\cdot\vec{x}_c}\f$ of
+    * each wavenumber from centering. Sized by number of wavenumbers.
+    */
+   std::vector<std::complex<double>> wave_factors_;
+
+   /**
+    * @brief Wavenumber indices, sorted by nearest wavenumber grid point
+    * along the first axis. Sized by number of wavenumbers.
+    */
+   std::vector<int> wave_order_;
+
+   /// Nearest grid point along first axis of each of \ref wave_order_.
+   std::vector<int> wave_grid_idx_;
+
+   /**
+    * @brief Combined phase, Gaussian, and scaling factor applied to the
+    * interpolated value at each point. Sized by number of points.
+    */
+   std::vector<std::complex<double>> point_factors_;
+
+   /// FFT grid workspace, sized [channel][FFT grid].
+   std::vector<std::complex<double>> grid_;
+
+   /// Number of points in the FFT grid, for a single channel.
+   std::size_t GridSize() const;
+
+   /// Spread the strengths onto \ref grid_, including deconvolution.
+   template<std::size_t TDim>
+   void Spread(const double *wave_ks, const std::complex<double> *strengths);
+
+   /// Interpolate the transformed \ref grid_ to each point.
+   template<std::size_t TDim>
+   void Interpolate(const double *coords, double *const *out) const;
+
+   /// Evaluate the direct sum.
+   void ExecuteDirect(const double *coords, const double *wave_ks,
+                        const std::complex<double> *strengths,
+                        double *const *out) const;
+
+public:
+
+   /// Construct an empty plan, for zero points and wavenumbers.
+   NUFFTPlan() = default;
+
+   /**
+    * @brief Construct a new NUFFTPlan object.
+    *
+    * @param dim           Spatial dimension.
+    * @param num_pts       Number of points.
+    * @param coords        Point coordinates, sized \p dim x \p num_pts with
+    *                      ordering [dim][point].
+    * @param num_waves     Number of wavenumbers.
+    * @param wave_ks       Wavenumber vectors, sized \p dim x \p num_waves
+    *                      with ordering [dim][wave].
+    * @param num_channels  Number of channels.
+    * @param tol           Relative tolerance, in (0,1).
+    */
+   NUFFTPlan(int dim, std::size_t num_pts, const double *coords,
+               int num_waves, const double *wave_ks, int num_channels,
+               double tol);
+
+   /// Check if the NUFFT is used, rather than the direct sum.
+   bool UsesFFT() const { return use_fft_; }
+
+   /**
+    * @brief Evaluate \f$f_q\f$ at all points, for all channels.
+    *
+    * @param coords        Point coordinates, as provided in construction.
+    * @param wave_ks       Wavenumber vectors, as provided in construction.
+    * @param strengths     Strengths \f$c_{qj}\f$, sized number of channels
+    *                      x number of wavenumbers with ordering
+    *                      [channel][wave].
+    * @param out           Output array for each channel, each sized by the
+    *                      number of points.
+    */
+   void Execute(const double *coords, const double *wave_ks,
+                  const std::complex<double> *strengths,
+                  double *const *out);
+};
+
+/**
+ * @brief Plan for evaluating sums of the form
+ * \f$f(s_i)=\text{Re}\sum_{j=0}^{W-1}c_je^{i(k_0+j\Delta k)s_i}\f$
+ * for fixed projected coordinates \f$s_i\f$ and uniformly spaced
+ * wavenumbers, with strengths \f$c_j\f$ that may change between
+ * evaluations.
+ *
+ * @details Factoring out the carrier \f$e^{ik_cs}\f$, where
+ * \f$k_c=k_0+\lfloor W/2\rfloor\Delta k\f$, the remaining envelope is a
+ * trigonometric polynomial of period \f$2\pi/|\Delta k|\f$. This is
+ * tabulated over one period on \f$M\ge W\f$ uniform points with a single
+ * inverse FFT, and interpolated to each \f$s_i\f$ with a Lagrange
+ * polynomial through the nearest \f$P\f$ table points. \f$M\f$ and
+ * \f$P\f$ are chosen to meet the tolerance at least cost.
+ *
+ * This costs O(\f$M\log M + NP\f$) per evaluation, for \f$N\f$ points.
+ * Where this is estimated to exceed the O(\f$WN\f$) direct sum, or the
+ * tolerance cannot be met, \ref UsesFFT() is false and the plan may not be
+ * executed.
+ *
+ * The error of \f$f\f$ is bounded by approximately the tolerance times
+ * \f$\sum_j|c_j|\f$.
+ */
+class ProgressionFFTPlan
+{
+private:
+
+   /// Number of points.
+   std::size_t num_pts_ = 0;
+
+   /// Number of wavenumbers.
+   int num_waves_ = 0;
+
+   /// If false, the plan may not be executed.
+   bool use_fft_ = false;
+
+   /// Size of the FFT, \f$M\f$.
+   int fft_size_ = 0;
+
+   /// Number of interpolation points, \f$P\f$.
+   int interp_pts_ = 0;
+
+   /// Barycentric weights of the interpolation points. Sized \ref interp_pts_.
+   std::vector<double> bary_weights_;
+
+   /**
+    * @brief First table index of the interpolation points of each point.
+    * Sized by number of points.
+    */
+   std::vector<int> base_idx_;
+
+   /**
+    * @brief Position of each point past the nearest preceding table point,
+    * in [0,1) table spacings. Sized by number of points.
+    */
+   std::vector<double> offsets_;
+
+   /// Carrier \f$e^{ik_cs_i}\f$ of each point. Sized by number of points.
+   std::vector<std::complex<double>> carriers_;
+
+   /// Envelope table workspace, sized \ref fft_size_.
+   std::vector<std::complex<double>> table_;
+
+public:
+
+   /// Construct an empty plan, for zero points and wavenumbers.
+   ProgressionFFTPlan() = default;
+
+   /**
+    * @brief Construct a new ProgressionFFTPlan object.
+    *
+    * @param num_pts       Number of points.
+    * @param projs         Projected coordinates \f$s_i\f$, sized
+    *                      \p num_pts.
+    * @param num_waves     Number of wavenumbers.
+    * @param k0            First wavenumber, \f$k_0\f$.
+    * @param dk            Wavenumber spacing, \f$\Delta k\ne0\f$.
+    * @param tol           Relative tolerance, in (0,1).
+    */
+   ProgressionFFTPlan(std::size_t num_pts, const double *projs,
+                        int num_waves, double k0, double dk, double tol);
+
+   /// Check if the FFT is used, such that the plan may be executed.
+   bool UsesFFT() const { return use_fft_; }
+
+   /**
+    * @brief Evaluate \f$f\f$ at all points.
+    *
+    * @param strengths     Strengths \f$c_j\f$, sized by number of
+    *                      wavenumbers.
+    * @param out           Output array, sized by number of points.
+    */
+   void Execute(const std::complex<double> *strengths, double *out);
+};
+
+} // namespace jabber
+
+#endif // JABBER_NUFFT
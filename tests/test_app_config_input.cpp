@@ -85,18 +85,121 @@ TEST_CASE("TOMLConfigInput::ParseComputation", "[App][TOMLConfigInput]")
    const AcousticField::Kernel kKernel = 
                                  GENERATE(options<AcousticField::Kernel>());
 
+   const int kResyncInterval = GENERATE(take(1,random(1,10000)));
+
+   const std::size_t kTileSize = GENERATE(take(1,random(1,10000)));
+
+   const bool kMixedPrecision = GENERATE(true, false);
+
+   const bool kDeterministic = GENERATE(true, false);
+
+   const Field kOutputField = GENERATE(options<Field>());
+
+   const Variables kOutputVariables = GENERATE(options<Variables>());
+
+   const Accuracy kAccuracy = GENERATE(options<Accuracy>());
+
+   const double kNUFFTTolerance = GENERATE(take(1,random(1e-14,1e-2)));
+
+   const double kExpansionTolerance = GENERATE(take(1,random(1e-14,1e-2)));
+
+   const double kLowRankTolerance = GENERATE(take(1,random(1e-14,1e-2)));
+
+   const double kMultiRateTolerance = GENERATE(take(1,random(1e-14,1e-2)));
+
+   const std::size_t kSnapshotCount = GENERATE(take(1,random(1,10000)));
+
+   const std::size_t kSnapshotMemory = GENERATE(take(1,random(1,1000000)));
+
+   const int kSnapshotOrder = GENERATE(take(1,random(0,10)));
+
+   constexpr std::string_view kAutotuneCache = "TestAutotune.cache";
+
+   constexpr std::string_view kEngine = "TestEngine";
+
    const std::string comp_str = 
       std::format(R"(
                      t0={}
                      Kernel='{}'
+                     Engine='{}'
+                     ResyncInterval={}
+                     TileSize={}
+                     MixedPrecision={}
+                     Deterministic={}
+                     OutputFields=['{}']
+                     OutputVariables='{}'
+                     Accuracy='{}'
+                     NUFFTTolerance={}
+                     ExpansionTolerance={}
+                     LowRankTolerance={}
+                     MultiRateTolerance={}
+                     SnapshotCount={}
+                     SnapshotMemory={}
+                     SnapshotOrder={}
+                     AutotuneCache='{}'
                   )", kT0, 
-                  KernelType::kNames[static_cast<std::size_t>(kKernel)]);
+                  KernelType::kNames[static_cast<std::size_t>(kKernel)],
+                  kEngine, kResyncInterval, kTileSize, kMixedPrecision, kDeterministic,
+                  FieldType::kNames[static_cast<std::size_t>(kOutputField)],
+                  VariablesType::kNames[
+                                 static_cast<std::size_t>(kOutputVariables)],
+                  AccuracyType::kNames[static_cast<std::size_t>(kAccuracy)],
+                  kNUFFTTolerance, kExpansionTolerance, kLowRankTolerance,
+                  kMultiRateTolerance,
+                  kSnapshotCount, kSnapshotMemory, kSnapshotOrder,
+                  kAutotuneCache);
 
    CompParams params;
    TOMLConfigInput::ParseComputation(comp_str, params);
 
    CHECK(params.t0 == kT0);
    CHECK(params.kernel == kKernel);
+   if (kKernel == AcousticField::Kernel::Custom)
+   {
+      CHECK(params.engine == kEngine);
+   }
+   else
+   {
+      CHECK_FALSE(params.engine.has_value());
+   }
+   CHECK(params.resync_interval == kResyncInterval);
+   CHECK(params.tile_size == kTileSize);
+   CHECK(params.mixed_precision == kMixedPrecision);
+   CHECK(params.deterministic == kDeterministic);
+   CHECK(params.output_fields == FieldBit(kOutputField));
+   CHECK(params.output_variables == kOutputVariables);
+   CHECK(params.accuracy == kAccuracy);
+   CHECK(params.nufft_tolerance == kNUFFTTolerance);
+   CHECK(params.expansion_tolerance == kExpansionTolerance);
+   CHECK(params.low_rank_tolerance == kLowRankTolerance);
+   CHECK(params.multi_rate_tolerance == kMultiRateTolerance);
+   CHECK(params.snapshot_count == kSnapshotCount);
+   CHECK(params.snapshot_memory == kSnapshotMemory);
+   CHECK(params.snapshot_order == kSnapshotOrder);
+   CHECK(params.autotune_cache == kAutotuneCache);
+
+   for (const std::string_view key : {"ResyncInterval", "TileSize", 
+                                       "SnapshotCount", "SnapshotMemory",
+                                       "SnapshotOrder"})
+   {
+      CHECK_THROWS_AS(TOMLConfigInput::ParseComputation(
+                        std::format("t0=0\nKernel='GridPoint'\n{}=-1", key),
+                        params), std::invalid_argument);
+   }
+
+   for (const std::string_view val : {"0", "2147483648"})
+   {
+      CHECK_THROWS_AS(TOMLConfigInput::ParseComputation(
+                        std::format("t0=0\nKernel='GridPoint'\n"
+                                    "ResyncInterval={}", val),
+                        params), std::invalid_argument);
+   }
+   CHECK_THROWS_AS(TOMLConfigInput::ParseComputation(
+                        "t0=0\nKernel='GridPoint'\nTileSize=0", params), 
+                   std::invalid_argument);
+   CHECK_THROWS_AS(TOMLConfigInput::ParseComputation(
+                        "t0=0\nKernel='GridPoint'\nSnapshotOrder=2147483648",
+                        params), std::invalid_argument);
 }
 
 TEST_CASE("TOMLConfigInput::ParsePrecice", "[App][TOMLConfigInput]")
@@ -12,7 +12,12 @@
 #endif // JABBER_WITH_OPENMP
 
 #include <cmath>
+#include <algorithm>
 #include <functional>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <stdexcept>
 
 using namespace jabber;
 using namespace Catch::Matchers;
@@ -100,18 +105,39 @@ private:
       }
    }
    static double U(double x, double t)
+   {
+      return 1000.0 + UPrime(x,t);
+   }
+public:
+   static double RhoPrime(double x, double t)
+   {
+      return (1.0/15625.0)*(PPrime(x,t));
+   }
+   static double UPrime(double x, double t)
    {
       if constexpr (NumWaves == 1)
       {
-         return 1000.0 + (1.0/(0.1792*125.0))*(-1.0*PPrimeWave1(x,t));
+         return (1.0/(0.1792*125.0))*(-1.0*PPrimeWave1(x,t));
       }
       else
       {
-         return 1000.0 + (1.0/(0.1792*125.0))*(-1.0*PPrimeWave1(x,t)
-                                                   + PPrimeWave2(x,t));
+         return (1.0/(0.1792*125.0))*(-1.0*PPrimeWave1(x,t)
+                                          + PPrimeWave2(x,t));
       }
    }
-public:
+   static double PressurePrime(double x, double t)
+   {
+      return PPrime(x,t);
+   }
+   static double RhoUPrime(double x, double t)
+   {
+      return 0.1792*UPrime(x,t) + 1000.0*RhoPrime(x,t);
+   }
+   static double RhoEPrime(double x, double t)
+   {
+      return (1.0/(1.4-1.0))*PPrime(x,t) + 0.1792*1000.0*UPrime(x,t)
+               + (1.0/2.0)*1000.0*1000.0*RhoPrime(x,t);
+   }
    static double Rho(double x, double t)
    {
       return 0.1792 + (1.0/15625.0)*(PPrime(x,t));
@@ -192,7 +218,6 @@ TEMPLATE_TEST_CASE_SIG("1D flowfield computation via kernel",
    {
       std::vector<double> rho_coeffs(kNumWaves);
       std::vector<double> rhoV_coeffs(kNumWaves);
-      std::vector<double> rhoE_coeffs(kNumWaves);
       std::vector<double> wave_omegas(kNumWaves);
       std::vector<double> k_dot_x_p_phi(kNumPts*kNumWaves);
 
@@ -202,7 +227,6 @@ TEMPLATE_TEST_CASE_SIG("1D flowfield computation via kernel",
          const int speed_encoder = (kSpeeds[w] == 'S' ? -1 : 1);
          rho_coeffs[w] = kPAmps[w]/(kCBar*kCBar);
          rhoV_coeffs[w] = speed_encoder*kPAmps[w]/(kRhoBar*kCBar);
-         rhoE_coeffs[w] = kPAmps[w]/(kGamma-1.0);
          wave_omegas[w] = 2*M_PI*kFreqs[w];
 
          const double k = (kSpeeds[w] == 'S' ? wave_omegas[w]/(kUBar - kCBar)
@@ -237,9 +261,8 @@ TEMPLATE_TEST_CASE_SIG("1D flowfield computation via kernel",
          ComputeKernel<1, TGridInnerLoop>(kNumPts, kRhoBar, kPBar, &kUBar,
                            kGamma, kNumWaves, time, 
                            rho_coeffs.data(), rhoV_coeffs.data(), 
-                           rhoE_coeffs.data(), wave_omegas.data(), 
-                           k_dot_x_p_phi.data(), rho.data(), 
-                           rhoU.data(), rhoE.data());
+                           wave_omegas.data(), k_dot_x_p_phi.data(), 
+                           rho.data(), rhoU.data(), rhoE.data());
 
          // Check solutions
          CheckSolution(kCoords, rho, rhoU, rhoE, time, kNumWaves);
@@ -260,9 +283,140 @@ TEST_CASE("1D flowfield computation via AcousticField",
                                                    kTimeExtents.second))));
 
    const AcousticField::Kernel kernel = 
-                        GENERATE(options<AcousticField::Kernel>());
+                        GENERATE(kernels());
+   CAPTURE(kernel);
+
+   // Include tile size not dividing number of points
+   const std::size_t kTileSize = GENERATE(std::size_t(2), kDefaultTileSize);
+   CAPTURE(kTileSize);
+
+   const int kNumWaves = GENERATE(1,2);
+   CAPTURE(kNumWaves);
+   DYNAMIC_SECTION("Number of waves: " << kNumWaves)
+   {
+      // Build AcousticField
+      std::vector<double> kUBar_vec = {kUBar};
+      AcousticField field(1, kCoords, kPBar, kRhoBar, kUBar_vec, kGamma, 
+                           kernel);
+      field.SetTileSize(kTileSize);
+      field.SetUnrolling(false);
+
+      // Add wave(s) + finalize
+      std::vector<double> dir_vec = {1.0};
+      for (int w = 0; w < kNumWaves; w++)
+      {
+         Wave wave{kPAmps[w], kFreqs[w], kPhases[w], kSpeeds[w], dir_vec};
+         field.AddWave(wave);
+      }
+      field.Finalize();
+
+      // Evaluate field
+      for (const double &time : kTimes)
+      {
+         // Compute
+         field.Compute(time);
+
+         // Check solutions
+         CheckSolution(kCoords, field.Density(), field.Momentum(),
+                        field.Energy(), time, kNumWaves);
+      }
+   }
+}
+
+TEST_CASE("1D flowfield computation via mixed-precision AcousticField", 
+            "[1D][Compute][AcousticField]")
+{
+   /// Relative tolerance, as perturbations are summed in single precision
+   constexpr double kMixedRelTol = 1e-7;
+
+   const std::vector<double> kCoords = 
+            GENERATE_REF(take(1, chunk(kNumPts, 
+                                          random(kSpaceExtents.first, 
+                                                   kSpaceExtents.second))));
+   const std::vector<double> kTimes =
+            GENERATE_REF(take(1, chunk(kNumTimes, 
+                                          random(kTimeExtents.first,
+                                                   kTimeExtents.second))));
+
+   // Include large times, where ωt is not representable in single precision
+   const double kTimeOffset = GENERATE(0.0, 1000.0);
+   CAPTURE(kTimeOffset);
+
+   const int kNumWaves = GENERATE(1,2);
+   CAPTURE(kNumWaves);
+   DYNAMIC_SECTION("Number of waves: " << kNumWaves)
+   {
+      // Build AcousticField
+      std::vector<double> kUBar_vec = {kUBar};
+      AcousticField field(1, kCoords, kPBar, kRhoBar, kUBar_vec, kGamma, 
+                           AcousticField::Kernel::GridPoint);
+      field.SetMixedPrecision(true);
+
+      // Add wave(s) + finalize
+      std::vector<double> dir_vec = {1.0};
+      for (int w = 0; w < kNumWaves; w++)
+      {
+         Wave wave{kPAmps[w], kFreqs[w], kPhases[w], kSpeeds[w], dir_vec};
+         field.AddWave(wave);
+      }
+      field.Finalize();
+
+      using function_t = std::function<double(double,double)>;
+      const function_t rho_exact = (kNumWaves == 1) ? 
+               AnalyticalSolution1D<1>::Rho : AnalyticalSolution1D<2>::Rho;
+      const function_t rhoU_exact = (kNumWaves == 1) ? 
+               AnalyticalSolution1D<1>::RhoU : AnalyticalSolution1D<2>::RhoU;
+      const function_t rhoE_exact = (kNumWaves == 1) ? 
+               AnalyticalSolution1D<1>::RhoE : AnalyticalSolution1D<2>::RhoE;
+
+      // Evaluate field
+      for (const double &time : kTimes)
+      {
+         const double t = time + kTimeOffset;
+         field.Compute(t);
+
+         for (std::size_t i = 0; i < kNumPts; i++)
+         {
+            const double x = kCoords[i];
+            CAPTURE(x, t);
+            CHECK_THAT(field.Density()[i], 
+                        WithinRel(rho_exact(x,t), kMixedRelTol));
+            CHECK_THAT(field.Momentum()[i], 
+                        WithinRel(rhoU_exact(x,t), kMixedRelTol));
+            CHECK_THAT(field.Energy()[i], 
+                        WithinRel(rhoE_exact(x,t), kMixedRelTol));
+         }
+      }
+   }
+}
+
+TEST_CASE("1D flowfield computation via AcousticField with reduced accuracy",
+            "[1D][Compute][AcousticField]")
+{
+   const std::vector<double> kCoords = 
+            GENERATE_REF(take(1, chunk(kNumPts, 
+                                          random(kSpaceExtents.first, 
+                                                   kSpaceExtents.second))));
+   const std::vector<double> kTimes =
+            GENERATE_REF(take(1, chunk(kNumTimes, 
+                                          random(kTimeExtents.first,
+                                                   kTimeExtents.second))));
+
+   const AcousticField::Kernel kernel = 
+                  GENERATE(AcousticField::Kernel::GridPoint, 
+                           AcousticField::Kernel::Wave);
    CAPTURE(kernel);
 
+   // The pressure perturbation is within the absolute error of each 
+   // cosine of the sum of absolute wave amplitudes
+   const auto [kAccuracy, kCosTol] = 
+               GENERATE(table<Accuracy, double>({{Accuracy::High, 1e-10},
+                                                 {Accuracy::Low, 1e-6}}));
+   CAPTURE(kAccuracy);
+
+   const bool kUnrolling = GENERATE(true, false);
+   CAPTURE(kUnrolling);
+
    const int kNumWaves = GENERATE(1,2);
    CAPTURE(kNumWaves);
    DYNAMIC_SECTION("Number of waves: " << kNumWaves)
@@ -271,6 +425,487 @@ TEST_CASE("1D flowfield computation via AcousticField",
       std::vector<double> kUBar_vec = {kUBar};
       AcousticField field(1, kCoords, kPBar, kRhoBar, kUBar_vec, kGamma, 
                            kernel);
+      field.SetCosineAccuracy(kAccuracy);
+      field.SetUnrolling(kUnrolling);
+
+      // Add wave(s) + finalize
+      std::vector<double> dir_vec = {1.0};
+      for (int w = 0; w < kNumWaves; w++)
+      {
+         Wave wave{kPAmps[w], kFreqs[w], kPhases[w], kSpeeds[w], dir_vec};
+         field.AddWave(wave);
+      }
+      field.Finalize();
+      CHECK(field.IsUnrolled() == kUnrolling);
+
+      // Evaluate field
+      CheckDirectSums(field, kCoords, kTimes, kCosTol);
+   }
+}
+
+TEST_CASE("1D flowfield computation via AcousticField with tile expansion",
+            "[1D][Compute][AcousticField]")
+{
+   /// Sized such that each tile holds several points
+   constexpr std::size_t kNumTilePts = 200;
+
+   const std::vector<double> kCoords = 
+            GENERATE_REF(take(1, chunk(kNumTilePts, 
+                                          random(kSpaceExtents.first, 
+                                                   kSpaceExtents.second))));
+   const std::vector<double> kTimes =
+            GENERATE_REF(take(1, chunk(kNumTimes, 
+                                          random(kTimeExtents.first,
+                                                   kTimeExtents.second))));
+
+   // Each Taylor expansion is truncated once its remainder is within the 
+   // tolerance of the sum of absolute wave amplitudes
+   const double kTol = GENERATE(1e-6, 1e-10);
+   CAPTURE(kTol);
+
+   const int kNumWaves = GENERATE(1,2);
+   CAPTURE(kNumWaves);
+   DYNAMIC_SECTION("Number of waves: " << kNumWaves)
+   {
+      // Build AcousticField
+      std::vector<double> kUBar_vec = {kUBar};
+      AcousticField field(1, kCoords, kPBar, kRhoBar, kUBar_vec, kGamma, 
+                           AcousticField::Kernel::TileExpansion);
+      field.SetExpansionTolerance(kTol);
+
+      // Add wave(s) + finalize
+      std::vector<double> dir_vec = {1.0};
+      for (int w = 0; w < kNumWaves; w++)
+      {
+         Wave wave{kPAmps[w], kFreqs[w], kPhases[w], kSpeeds[w], dir_vec};
+         field.AddWave(wave);
+      }
+      field.Finalize();
+
+      // Evaluate field
+      CheckDirectSums(field, kCoords, kTimes, kTol);
+   }
+}
+
+TEST_CASE("1D flowfield computation via AcousticField with low-rank "
+            "factorization", "[1D][Compute][AcousticField]")
+{
+   /// Waves of a narrow band, such that the phasors are of low rank
+   constexpr int kNumBandWaves = 64;
+   constexpr std::pair<double,double> kBandExtents{1000.0, 1100.0};
+
+   /// Sized such that the factorization is cheaper than the direct sum
+   constexpr std::size_t kNumBandPts = 200;
+
+   const std::vector<double> kCoords = 
+            GENERATE_REF(take(1, chunk(kNumBandPts, 
+                                          random(kSpaceExtents.first, 
+                                                   kSpaceExtents.second))));
+   const std::vector<double> kTimes =
+            GENERATE_REF(take(1, chunk(kNumTimes, 
+                                          random(kTimeExtents.first,
+                                                   kTimeExtents.second))));
+
+   // The residual of the phasors in the basis is within the tolerance at 
+   // each point, relative to the norm of the amplitudes, so the pressure 
+   // perturbation is within the tolerance of the sum of absolute wave 
+   // amplitudes
+   const double kTol = GENERATE(1e-6, 1e-10);
+   CAPTURE(kTol);
+
+   // Build AcousticField
+   std::vector<double> kUBar_vec = {kUBar};
+   AcousticField field(1, kCoords, kPBar, kRhoBar, kUBar_vec, kGamma, 
+                        AcousticField::Kernel::LowRank);
+   field.SetLowRankTolerance(kTol);
+
+   // Add waves + finalize
+   field.Waves() = RandomWaves(1, kNumBandWaves, kBandExtents);
+   field.Finalize();
+   CHECK_FALSE(field.UsesRecurrence());
+
+   // Factorized below the maximum rank of half the waves, rather than 
+   // falling back to the direct sum
+   constexpr std::size_t kMaxRankBytes = 
+               (kNumBandWaves/2)*(2*kNumBandWaves + kNumBandPts)*
+               sizeof(double);
+   CHECK(field.EngineMemory() > 0);
+   CHECK(field.EngineMemory() < kMaxRankBytes);
+
+   // Evaluate field
+   CheckDirectSums(field, kCoords, kTimes, kTol);
+}
+
+TEST_CASE("1D deterministic flowfield computation via AcousticField",
+            "[1D][Compute][AcousticField]")
+{
+   /// Number of waves, split into several wave blocks
+   constexpr int kNumDetWaves = 5*kDeterministicBlockWaves;
+
+   /// Sized with two tiles, such that waves are split over threads for 
+   /// more than two threads
+   constexpr std::size_t kNumDetPts = 64;
+   constexpr std::size_t kDetTileSize = 32;
+
+   /// Points excluded from a partition, such that its tiles are misaligned
+   constexpr std::size_t kOffset = 3;
+
+   const std::vector<double> kCoords = 
+            GENERATE_REF(take(1, chunk(kNumDetPts, 
+                                          random(kSpaceExtents.first, 
+                                                   kSpaceExtents.second))));
+   const std::vector<double> kTimes =
+            GENERATE_REF(take(1, chunk(kNumTimes, 
+                                          random(kTimeExtents.first,
+                                                   kTimeExtents.second))));
+   const std::vector<double> kAmps = 
+            GENERATE_REF(take(1, chunk(kNumDetWaves, random(1.0, 10.0))));
+   const std::vector<double> kDetFreqs = 
+            GENERATE_REF(take(1, chunk(kNumDetWaves, random(500.0, 1500.0))));
+   const std::vector<double> kDetPhases = 
+            GENERATE_REF(take(1, chunk(kNumDetWaves, random(0.0, 2*M_PI))));
+
+   // Build deterministic AcousticField of the points from an offset
+   std::vector<double> kUBar_vec = {kUBar};
+   const auto MakeField = [&](const std::size_t offset)
+   {
+      auto field = std::make_unique<AcousticField>(1, 
+                     std::span<const double>(kCoords).subspan(offset), kPBar,
+                     kRhoBar, kUBar_vec, kGamma, 
+                     AcousticField::Kernel::GridPoint);
+      field->SetTileSize(kDetTileSize);
+      field->SetDeterministic(true);
+      std::vector<double> dir_vec = {1.0};
+      for (int w = 0; w < kNumDetWaves; w++)
+      {
+         Wave wave{kAmps[w], kDetFreqs[w], kDetPhases[w], 'F', dir_vec};
+         field->AddWave(wave);
+      }
+      field->Finalize();
+      return field;
+   };
+
+#ifdef JABBER_WITH_OPENMP
+   const int max_threads = omp_get_max_threads();
+   omp_set_dynamic(0);
+   omp_set_num_threads(1);
+#endif // JABBER_WITH_OPENMP
+
+   std::unique_ptr<AcousticField> field = MakeField(0);
+   CHECK(field->IsDeterministic());
+   CHECK_FALSE(field->IsCollapsed());
+   CHECK_FALSE(field->UsesRecurrence());
+   std::unique_ptr<AcousticField> partition = MakeField(kOffset);
+
+   const double kCBar = std::sqrt(kGamma*kPBar/kRhoBar);
+   for (const double &time : kTimes)
+   {
+      CAPTURE(time);
+      field->Compute(time);
+      const std::vector<double> rho(field->Density().begin(), 
+                                    field->Density().end());
+      const std::vector<double> rhoU(field->Momentum().begin(), 
+                                       field->Momentum().end());
+      const std::vector<double> rhoE(field->Energy().begin(), 
+                                       field->Energy().end());
+
+      for (std::size_t i = 0; i < kNumDetPts; i++)
+      {
+         const double x = kCoords[i];
+         double p_prime = 0.0;
+         for (int w = 0; w < kNumDetWaves; w++)
+         {
+            const double omega = 2*M_PI*kDetFreqs[w];
+            p_prime += kAmps[w]*std::cos((omega/(kCBar + kUBar))*x + 
+                                          kDetPhases[w] - omega*time);
+         }
+         const double rho_exact = kRhoBar + p_prime/(kCBar*kCBar);
+         const double u_exact = kUBar + p_prime/(kRhoBar*kCBar);
+         CAPTURE(x);
+         CHECK_THAT(rho[i], WithinRel(rho_exact, 1e-12));
+         CHECK_THAT(rhoU[i], WithinRel(rho_exact*u_exact, 1e-12));
+         CHECK_THAT(rhoE[i], WithinRel((kPBar + p_prime)/(kGamma - 1.0) + 
+                                          0.5*rho_exact*u_exact*u_exact, 
+                                       1e-12));
+      }
+
+      // Bitwise equal for a partition of the points
+      partition->Compute(time);
+      for (std::size_t i = kOffset; i < kNumDetPts; i++)
+      {
+         CAPTURE(i);
+         CHECK(partition->Density()[i - kOffset] == rho[i]);
+         CHECK(partition->Momentum()[i - kOffset] == rhoU[i]);
+         CHECK(partition->Energy()[i - kOffset] == rhoE[i]);
+      }
+
+#ifdef JABBER_WITH_OPENMP
+      // Bitwise equal for any number of threads
+      for (const int num_threads : {2, 3, 4})
+      {
+         CAPTURE(num_threads);
+         omp_set_num_threads(num_threads);
+         field->Compute(time);
+         for (std::size_t i = 0; i < kNumDetPts; i++)
+         {
+            CAPTURE(i);
+            CHECK(field->Density()[i] == rho[i]);
+            CHECK(field->Momentum()[i] == rhoU[i]);
+            CHECK(field->Energy()[i] == rhoE[i]);
+         }
+      }
+      omp_set_num_threads(1);
+#endif // JABBER_WITH_OPENMP
+   }
+
+#ifdef JABBER_WITH_OPENMP
+   omp_set_num_threads(max_threads);
+#endif // JABBER_WITH_OPENMP
+}
+
+TEST_CASE("1D flowfield computation via AcousticField with output fields",
+            "[1D][Compute][AcousticField]")
+{
+   const AcousticField::Kernel kKernel = GENERATE(kernels());
+   const Field kField = GENERATE(options<Field>());
+   const bool kUnrolling = GENERATE(true, false);
+   const int kNumWaves = GENERATE(1,2);
+   CAPTURE(kKernel, kField, kUnrolling, kNumWaves);
+
+   const std::vector<double> kCoords = 
+            GENERATE_REF(take(1, chunk(kNumPts, 
+                                          random(kSpaceExtents.first, 
+                                                   kSpaceExtents.second))));
+   const std::vector<double> kTimes =
+            GENERATE_REF(take(1, chunk(kNumTimes, 
+                                          random(kTimeExtents.first,
+                                                   kTimeExtents.second))));
+
+   // Build AcousticField with all outputs or only kField
+   std::vector<double> kUBar_vec = {kUBar};
+   const auto MakeField = [&](const FieldMask fields)
+   {
+      auto field = std::make_unique<AcousticField>(1, kCoords, kPBar,
+                                                   kRhoBar, kUBar_vec, 
+                                                   kGamma, kKernel);
+      field->SetUnrolling(kUnrolling);
+      field->SetOutputFields(fields);
+      std::vector<double> dir_vec = {1.0};
+      for (int w = 0; w < kNumWaves; w++)
+      {
+         Wave wave{kPAmps[w], kFreqs[w], kPhases[w], kSpeeds[w], dir_vec};
+         field->AddWave(wave);
+      }
+      field->Finalize();
+      return field;
+   };
+   std::unique_ptr<AcousticField> full = MakeField(kAllFields);
+   std::unique_ptr<AcousticField> masked = MakeField(FieldBit(kField));
+   CHECK(masked->OutputFields() == FieldBit(kField));
+   if (kKernel == AcousticField::Kernel::GridPoint || 
+         kKernel == AcousticField::Kernel::Wave)
+   {
+      CHECK(masked->IsUnrolled() == kUnrolling);
+   }
+
+   // Outputs not requested are left as set. Requested outputs may differ 
+   // from the full field by the summation order of kernels that skip the 
+   // velocity series.
+   constexpr double kSentinel = -1.0;
+   constexpr double kTol = 1e-12;
+   std::ranges::fill(masked->Density(), kSentinel);
+   std::ranges::fill(masked->Momentum(), kSentinel);
+   std::ranges::fill(masked->Energy(), kSentinel);
+
+   for (const double &time : kTimes)
+   {
+      CAPTURE(time);
+      full->Compute(time);
+      masked->Compute(time);
+      for (std::size_t i = 0; i < kNumPts; i++)
+      {
+         CAPTURE(i);
+         CHECK_THAT(masked->Density()[i], 
+                     WithinRel(kField == Field::Density ? 
+                                 full->Density()[i] : kSentinel, kTol));
+         CHECK_THAT(masked->Momentum()[i], 
+                     WithinRel(kField == Field::Momentum ? 
+                                 full->Momentum()[i] : kSentinel, kTol));
+         CHECK_THAT(masked->Energy()[i], 
+                     WithinRel(kField == Field::Energy ? 
+                                 full->Energy()[i] : kSentinel, kTol));
+      }
+   }
+
+   CHECK_THROWS_AS(masked->SetOutputFields(0), std::invalid_argument);
+   CHECK_THROWS_AS(masked->SetOutputFields(kAllFields + 1), 
+                     std::invalid_argument);
+}
+
+TEST_CASE("1D perturbation computation via AcousticField",
+            "[1D][Compute][AcousticField]")
+{
+   const std::vector<double> kCoords = 
+            GENERATE_REF(take(1, chunk(kNumPts, 
+                                          random(kSpaceExtents.first, 
+                                                   kSpaceExtents.second))));
+   const std::vector<double> kTimes =
+            GENERATE_REF(take(1, chunk(kNumTimes, 
+                                          random(kTimeExtents.first,
+                                                   kTimeExtents.second))));
+
+   const AcousticField::Kernel kKernel = GENERATE(kernels());
+   const Variables kVariables = GENERATE(Variables::Primitive, 
+                                          Variables::Linearized);
+   const bool kUnrolling = GENERATE(true, false);
+   CAPTURE(kKernel, kVariables, kUnrolling);
+
+   const int kNumWaves = GENERATE(1,2);
+   CAPTURE(kNumWaves);
+   DYNAMIC_SECTION("Number of waves: " << kNumWaves)
+   {
+      // Build AcousticField
+      std::vector<double> kUBar_vec = {kUBar};
+      AcousticField field(1, kCoords, kPBar, kRhoBar, kUBar_vec, kGamma, 
+                           kKernel);
+      field.SetUnrolling(kUnrolling);
+      field.SetOutputVariables(kVariables);
+      CHECK(field.OutputVariables() == kVariables);
+
+      // Add wave(s) + finalize
+      std::vector<double> dir_vec = {1.0};
+      for (int w = 0; w < kNumWaves; w++)
+      {
+         Wave wave{kPAmps[w], kFreqs[w], kPhases[w], kSpeeds[w], dir_vec};
+         field.AddWave(wave);
+      }
+      field.Finalize();
+
+      using function_t = std::function<double(double,double)>;
+      function_t rho_exact, rhoU_exact, rhoE_exact;
+      if (kVariables == Variables::Primitive)
+      {
+         rho_exact = (kNumWaves == 1) ? AnalyticalSolution1D<1>::RhoPrime :
+                                          AnalyticalSolution1D<2>::RhoPrime;
+         rhoU_exact = (kNumWaves == 1) ? AnalyticalSolution1D<1>::UPrime :
+                                          AnalyticalSolution1D<2>::UPrime;
+         rhoE_exact = (kNumWaves == 1) ? 
+                                 AnalyticalSolution1D<1>::PressurePrime :
+                                 AnalyticalSolution1D<2>::PressurePrime;
+      }
+      else
+      {
+         rho_exact = (kNumWaves == 1) ? AnalyticalSolution1D<1>::RhoPrime :
+                                          AnalyticalSolution1D<2>::RhoPrime;
+         rhoU_exact = (kNumWaves == 1) ? AnalyticalSolution1D<1>::RhoUPrime :
+                                          AnalyticalSolution1D<2>::RhoUPrime;
+         rhoE_exact = (kNumWaves == 1) ? AnalyticalSolution1D<1>::RhoEPrime :
+                                          AnalyticalSolution1D<2>::RhoEPrime;
+      }
+
+      // Perturbations cross zero, so are compared to within either
+      constexpr double kTol = 1e-10;
+      for (const double &time : kTimes)
+      {
+         field.Compute(time);
+
+         for (std::size_t i = 0; i < kNumPts; i++)
+         {
+            const double x = kCoords[i];
+            CAPTURE(x, time);
+            CHECK_THAT(field.Density()[i], 
+                        WithinRel(rho_exact(x,time), kTol) || 
+                        WithinAbs(rho_exact(x,time), kTol));
+            CHECK_THAT(field.Momentum()[i], 
+                        WithinRel(rhoU_exact(x,time), kTol) || 
+                        WithinAbs(rhoU_exact(x,time), kTol));
+            CHECK_THAT(field.Energy()[i], 
+                        WithinRel(rhoE_exact(x,time), kTol) || 
+                        WithinAbs(rhoE_exact(x,time), kTol));
+         }
+      }
+   }
+}
+
+TEST_CASE("1D flowfield time-marching via AcousticField with multi-rate "
+            "bands", "[1D][Compute][AcousticField]")
+{
+   /// Waves over several octaves, such that low bands are interpolated
+   constexpr int kNumBandWaves = 48;
+   constexpr std::pair<double,double> kLogFreqExtents{2.0, 4.3};
+
+   /// Number of steps to march through, resolving the highest frequency
+   constexpr int kNumSteps = 100;
+   constexpr double kDt = 1e-6;
+
+   const std::vector<double> kCoords = 
+            GENERATE_REF(take(1, chunk(kNumPts, 
+                                          random(kSpaceExtents.first, 
+                                                   kSpaceExtents.second))));
+   const double kT0 = GENERATE(take(1, random(kTimeExtents.first,
+                                                kTimeExtents.second)));
+
+   // Each interpolated band is within its share of the tolerance of the 
+   // sum of absolute wave amplitudes by the remainder of its cubic Hermite
+   // interpolation, and the others are evaluated directly
+   const double kTol = GENERATE(1e-6, 1e-10);
+   CAPTURE(kTol);
+
+   // Build AcousticField
+   std::vector<double> kUBar_vec = {kUBar};
+   AcousticField field(1, kCoords, kPBar, kRhoBar, kUBar_vec, kGamma, 
+                        AcousticField::Kernel::MultiRate);
+   field.SetMultiRateTolerance(kTol);
+
+   // Add waves, log-uniform in frequency + finalize
+   field.Waves() = RandomWaves(1, kNumBandWaves, kLogFreqExtents);
+   for (Wave &wave : field.Waves())
+   {
+      wave.frequency = std::pow(10.0, wave.frequency);
+   }
+   field.Finalize();
+   CHECK_FALSE(field.UsesRecurrence());
+
+   // March field, evaluating the stages of a midpoint step between steps
+   field.Compute(kT0);
+   for (int n = 1; n <= kNumSteps; n++)
+   {
+      field.Advance(kDt);
+      const double time = field.Time();
+      CheckDirectSum(field, kCoords, kTol);
+
+      const std::vector<double> kStageTimes = {time - 0.5*kDt, time};
+      CheckDirectSums(field, kCoords, kStageTimes, kTol);
+   }
+}
+
+TEST_CASE("1D flowfield computation via AcousticField with snapshots",
+            "[1D][Compute][AcousticField]")
+{
+   const std::vector<double> kCoords = 
+            GENERATE_REF(take(1, chunk(kNumPts, 
+                                          random(kSpaceExtents.first, 
+                                                   kSpaceExtents.second))));
+   const std::vector<double> kTimes =
+            GENERATE_REF(take(1, chunk(kNumTimes, 
+                                          random(kTimeExtents.first,
+                                                   kTimeExtents.second))));
+
+   /// Number of snapshots per period, resolving each wave
+   constexpr std::size_t kNumSnapshots = 256;
+
+   const int kOrder = GENERATE(0, 8);
+   CAPTURE(kOrder);
+
+   const int kNumWaves = GENERATE(1,2);
+   CAPTURE(kNumWaves);
+   DYNAMIC_SECTION("Number of waves: " << kNumWaves)
+   {
+      // Build AcousticField
+      std::vector<double> kUBar_vec = {kUBar};
+      AcousticField field(1, kCoords, kPBar, kRhoBar, kUBar_vec, kGamma);
+      field.SetSnapshotCount(kNumSnapshots);
+      field.SetSnapshotOrder(kOrder);
 
       // Add wave(s) + finalize
       std::vector<double> dir_vec = {1.0};
@@ -281,6 +916,250 @@ TEST_CASE("1D flowfield computation via AcousticField",
       }
       field.Finalize();
 
+      // Frequencies of 1000 and 1250 share a fundamental of 250
+      const double kPeriod = (kNumWaves == 1) ? 1.0/kFreqs[0] : 1.0/250.0;
+      REQUIRE(field.UsesSnapshots());
+      CHECK_THAT(field.Period(), WithinRel(kPeriod, 1e-12));
+
+      // Snapshots whose total size overflows are beyond any budget
+      constexpr std::size_t kSnapshotSize = 3*kNumPts;
+      AcousticField overflow_field(1, kCoords, kPBar, kRhoBar, kUBar_vec, 
+                                    kGamma);
+      overflow_field.SetSnapshotCount(
+               std::numeric_limits<std::size_t>::max()/kSnapshotSize + 1);
+      overflow_field.Waves() = field.Waves();
+      overflow_field.Finalize();
+      CHECK_FALSE(overflow_field.UsesSnapshots());
+
+      // March over two periods, copying each snapshot
+      const double kDt = kPeriod/kNumSnapshots;
+      field.Compute(0.0);
+      for (std::size_t n = 1; n <= 2*kNumSnapshots; n++)
+      {
+         field.Advance(kDt);
+         CheckSolution(kCoords, field.Density(), field.Momentum(),
+                        field.Energy(), field.Time(), kNumWaves);
+      }
+
+      // Times between snapshots are evaluated exactly, or interpolated
+      using function_t = std::function<double(double,double)>;
+      const function_t rho_exact = (kNumWaves == 1) ? 
+                                    AnalyticalSolution1D<1>::Rho : 
+                                    AnalyticalSolution1D<2>::Rho;
+      const function_t rhoU_exact = (kNumWaves == 1) ? 
+                                    AnalyticalSolution1D<1>::RhoU : 
+                                    AnalyticalSolution1D<2>::RhoU;
+      const function_t rhoE_exact = (kNumWaves == 1) ? 
+                                    AnalyticalSolution1D<1>::RhoE : 
+                                    AnalyticalSolution1D<2>::RhoE;
+      constexpr double kTol = 1e-10;
+      for (const double &time : kTimes)
+      {
+         field.Compute(time);
+         if (kOrder == 0)
+         {
+            CheckSolution(kCoords, field.Density(), field.Momentum(),
+                           field.Energy(), field.Time(), kNumWaves);
+            continue;
+         }
+
+         for (std::size_t i = 0; i < kNumPts; i++)
+         {
+            const double x = kCoords[i];
+            CAPTURE(x, time);
+            CHECK_THAT(field.Density()[i], WithinRel(rho_exact(x,time), kTol));
+            CHECK_THAT(field.Momentum()[i], 
+                        WithinRel(rhoU_exact(x,time), kTol));
+            CHECK_THAT(field.Energy()[i], WithinRel(rhoE_exact(x,time), kTol));
+         }
+      }
+   }
+}
+
+TEST_CASE("1D flowfield computation via autotuned AcousticField", 
+            "[1D][Compute][AcousticField]")
+{
+   const std::vector<double> kCoords = 
+            GENERATE_REF(take(1, chunk(kNumPts, 
+                                          random(kSpaceExtents.first, 
+                                                   kSpaceExtents.second))));
+   const std::vector<double> kTimes =
+            GENERATE_REF(take(1, chunk(kNumTimes, 
+                                          random(kTimeExtents.first,
+                                                   kTimeExtents.second))));
+
+   const std::filesystem::path kCachePath = 
+            std::filesystem::temp_directory_path() / "jabber_test_autotune";
+   std::filesystem::remove(kCachePath);
+
+   // Few waves are unrolled by GridPoint and Wave, which are timed as such
+   const bool kUnrolling = GENERATE(true, false);
+   CAPTURE(kUnrolling);
+
+   const int kNumWaves = GENERATE(1,2);
+   CAPTURE(kNumWaves);
+   DYNAMIC_SECTION("Number of waves: " << kNumWaves)
+   {
+      // Build AcousticField, tuning the first + reading the cache after
+      std::vector<double> kUBar_vec = {kUBar};
+      std::vector<double> dir_vec = {1.0};
+      AcousticField::Kernel tuned_kernel = AcousticField::Kernel::Auto;
+      std::size_t tuned_tile_size = 0;
+      for (int run = 0; run < 2; run++)
+      {
+         AcousticField field(1, kCoords, kPBar, kRhoBar, kUBar_vec, kGamma, 
+                              AcousticField::Kernel::Auto);
+         field.SetAutotuneCachePath(kCachePath.string());
+         field.SetUnrolling(kUnrolling);
+
+         // Add wave(s) + finalize
+         for (int w = 0; w < kNumWaves; w++)
+         {
+            Wave wave{kPAmps[w], kFreqs[w], kPhases[w], kSpeeds[w], dir_vec};
+            field.AddWave(wave);
+         }
+         field.Finalize();
+
+         const AcousticField::Kernel selected = field.SelectedKernel();
+         CHECK(selected != AcousticField::Kernel::Auto);
+         CHECK(field.IsUnrolled() == 
+                  (kUnrolling && 
+                     (selected == AcousticField::Kernel::GridPoint ||
+                      selected == AcousticField::Kernel::Wave)));
+         CHECK(std::filesystem::exists(kCachePath));
+         if (run == 0)
+         {
+            tuned_kernel = field.SelectedKernel();
+            tuned_tile_size = field.TileSize();
+         }
+         else
+         {
+            CHECK(field.SelectedKernel() == tuned_kernel);
+            CHECK(field.TileSize() == tuned_tile_size);
+         }
+
+         // Evaluate field
+         for (const double &time : kTimes)
+         {
+            // Compute
+            field.Compute(time);
+
+            // Check solutions
+            CheckSolution(kCoords, field.Density(), field.Momentum(),
+                           field.Energy(), time, kNumWaves);
+         }
+      }
+   }
+
+   std::filesystem::remove(kCachePath);
+}
+
+/**
+ * @brief ComputeEngine evaluating the series on the fly in 1D only, as 
+ * registered by users.
+ */
+class TestEngine : public ComputeEngine
+{
+public:
+   EngineCapabilities Capabilities() const override
+   {
+      EngineCapabilities caps;
+      caps.dims = 0b001;
+      return caps;
+   }
+
+   std::size_t MemoryEstimate(const WaveSeries&) const override { return 0; }
+
+   void Finalize(const WaveSeries&) override { }
+
+   void Compute(const WaveSeries &series, double t, double *rho, 
+                  double *rhoV, double *rhoE) override
+   {
+      ComputeOnTheFlyKernel<1>(series.num_pts, series.rho_bar, series.p_bar,
+                                 series.U_bar, series.gamma, series.num_waves,
+                                 t, series.rho_coeffs, series.rhoV_coeffs,
+                                 series.wave_omegas, series.wave_ks, 
+                                 series.wave_phases, series.coords, rho, 
+                                 rhoV, rhoE);
+   }
+};
+
+TEST_CASE("1D flowfield computation via registered ComputeEngine", 
+            "[1D][Compute][AcousticField]")
+{
+   const std::vector<double> kCoords = 
+            GENERATE_REF(take(1, chunk(kNumPts, 
+                                          random(kSpaceExtents.first, 
+                                                   kSpaceExtents.second))));
+   const std::vector<double> kTimes =
+            GENERATE_REF(take(1, chunk(kNumTimes, 
+                                          random(kTimeExtents.first,
+                                                   kTimeExtents.second))));
+
+   const std::string kName = "Test";
+   const EngineRegistry::Factory kFactory = [](const AcousticField&)
+                                    { return std::make_unique<TestEngine>(); };
+   const EngineCapabilities kCaps = TestEngine().Capabilities();
+   const ScopedRegistration registration(kName, kFactory, kCaps);
+   CHECK_THROWS_AS(EngineRegistry::Register(kName, kFactory, kCaps), 
+                     std::invalid_argument);
+   CHECK(EngineRegistry::Capabilities(kName).dims == kCaps.dims);
+   CHECK_FALSE(EngineRegistry::Capabilities(kName).autotuned);
+   CHECK(EngineRegistry::Capabilities(
+            EngineRegistry::kBuiltinNames.front()).autotuned);
+   CHECK_THROWS_AS(EngineRegistry::Capabilities("Unregistered"), 
+                     std::invalid_argument);
+   CHECK_THROWS_AS(EngineRegistry::Unregister(
+                     EngineRegistry::kBuiltinNames.front()), 
+                     std::invalid_argument);
+   CHECK_THROWS_AS(EngineRegistry::Unregister("Unregistered"), 
+                     std::invalid_argument);
+
+   const int kNumWaves = GENERATE(1,2);
+   CAPTURE(kNumWaves);
+   DYNAMIC_SECTION("Number of waves: " << kNumWaves)
+   {
+      // Build AcousticField
+      std::vector<double> kUBar_vec = {kUBar};
+      AcousticField field(1, kCoords, kPBar, kRhoBar, kUBar_vec, kGamma);
+      field.SetEngine(kName);
+      CHECK_THROWS_AS(field.SetEngine("Unregistered"), 
+                        std::invalid_argument);
+
+      // Add wave(s) + finalize
+      std::vector<double> dir_vec = {1.0};
+      for (int w = 0; w < kNumWaves; w++)
+      {
+         Wave wave{kPAmps[w], kFreqs[w], kPhases[w], kSpeeds[w], dir_vec};
+         field.AddWave(wave);
+      }
+      field.Finalize();
+
+      CHECK(field.EngineName() == kName);
+      CHECK(field.SelectedKernel() == AcousticField::Kernel::Custom);
+      CHECK_FALSE(field.IsUnrolled());
+
+      // Registered engines are not candidates of Kernel::Auto unless they
+      // opt in
+      AcousticField auto_field(1, kCoords, kPBar, kRhoBar, kUBar_vec, kGamma,
+                                 AcousticField::Kernel::Auto);
+      auto_field.SetUnrolling(false);
+      auto_field.SetCollapsing(false);
+      auto_field.SetRecurrence(false);
+      auto_field.Waves() = field.Waves();
+      auto_field.Finalize();
+      CHECK(auto_field.EngineName() != kName);
+
+      // Only supported dimensions and selected engines may be finalized
+      const std::vector<double> kCoords2D(2*kNumPts, 0.0);
+      const std::vector<double> kUBar2D(2, 0.0);
+      AcousticField field_2d(2, kCoords2D, kPBar, kRhoBar, kUBar2D, kGamma);
+      field_2d.SetEngine(kName);
+      CHECK_THROWS_AS(field_2d.Finalize(), std::invalid_argument);
+      AcousticField custom_field(1, kCoords, kPBar, kRhoBar, kUBar_vec, 
+                                 kGamma, AcousticField::Kernel::Custom);
+      CHECK_THROWS_AS(custom_field.Finalize(), std::invalid_argument);
+
       // Evaluate field
       for (const double &time : kTimes)
       {
@@ -294,6 +1173,124 @@ TEST_CASE("1D flowfield computation via AcousticField",
    }
 }
 
+TEST_CASE("1D flowfield computation via AcousticField::ComputeBatch", 
+            "[1D][Compute][AcousticField]")
+{
+   const std::vector<double> kCoords = 
+            GENERATE_REF(take(1, chunk(kNumPts, 
+                                          random(kSpaceExtents.first, 
+                                                   kSpaceExtents.second))));
+   const std::vector<double> kTimes =
+            GENERATE_REF(take(1, chunk(kNumTimes, 
+                                          random(kTimeExtents.first,
+                                                   kTimeExtents.second))));
+
+   const AcousticField::Kernel kernel = 
+                        GENERATE(kernels());
+   CAPTURE(kernel);
+
+   const int kNumWaves = GENERATE(1,2);
+   CAPTURE(kNumWaves);
+   DYNAMIC_SECTION("Number of waves: " << kNumWaves)
+   {
+      // Build AcousticField
+      std::vector<double> kUBar_vec = {kUBar};
+      AcousticField field(1, kCoords, kPBar, kRhoBar, kUBar_vec, kGamma, 
+                           kernel);
+
+      // Add wave(s) + finalize
+      std::vector<double> dir_vec = {1.0};
+      for (int w = 0; w < kNumWaves; w++)
+      {
+         Wave wave{kPAmps[w], kFreqs[w], kPhases[w], kSpeeds[w], dir_vec};
+         field.AddWave(wave);
+      }
+      field.Finalize();
+
+      // Evaluate field at all times
+      std::vector<double> rho(kNumTimes*kNumPts);
+      std::vector<double> rhoU(kNumTimes*kNumPts);
+      std::vector<double> rhoE(kNumTimes*kNumPts);
+      field.ComputeBatch(kTimes, rho, rhoU, rhoE);
+
+      // Check solutions
+      for (std::size_t t = 0; t < kNumTimes; t++)
+      {
+         CheckSolution(kCoords, 
+                        std::span(rho).subspan(t*kNumPts, kNumPts),
+                        std::span(rhoU).subspan(t*kNumPts, kNumPts),
+                        std::span(rhoE).subspan(t*kNumPts, kNumPts),
+                        kTimes[t], kNumWaves);
+      }
+
+      // Field is left at the last time
+      REQUIRE(field.Time() == kTimes.back());
+      CheckSolution(kCoords, field.Density(), field.Momentum(),
+                     field.Energy(), field.Time(), kNumWaves);
+
+      // Mismatched output sizes
+      rho.pop_back();
+      CHECK_THROWS_AS(field.ComputeBatch(kTimes, rho, rhoU, rhoE), 
+                        std::invalid_argument);
+   }
+}
+
+TEST_CASE("1D flowfield time-marching via AcousticField::Advance", 
+            "[1D][Compute][AcousticField]")
+{
+   const std::vector<double> kCoords = 
+            GENERATE_REF(take(1, chunk(kNumPts, 
+                                          random(kSpaceExtents.first, 
+                                                   kSpaceExtents.second))));
+   const double kT0 = GENERATE(take(1, random(kTimeExtents.first,
+                                                kTimeExtents.second)));
+
+   /// Number of steps to march through
+   constexpr int kNumSteps = 100;
+   const double kDt = (kTimeExtents.second - kTimeExtents.first)/kNumSteps;
+
+   const AcousticField::Kernel kernel = 
+                        GENERATE(kernels());
+   CAPTURE(kernel);
+
+   const int kResyncInterval = GENERATE(1, 7, 1000);
+   CAPTURE(kResyncInterval);
+
+   const int kNumWaves = GENERATE(1,2);
+   CAPTURE(kNumWaves);
+   DYNAMIC_SECTION("Number of waves: " << kNumWaves)
+   {
+      // Build AcousticField
+      std::vector<double> kUBar_vec = {kUBar};
+      AcousticField field(1, kCoords, kPBar, kRhoBar, kUBar_vec, kGamma, 
+                           kernel);
+      field.SetResyncInterval(kResyncInterval);
+
+      // Add wave(s) + finalize
+      std::vector<double> dir_vec = {1.0};
+      for (int w = 0; w < kNumWaves; w++)
+      {
+         Wave wave{kPAmps[w], kFreqs[w], kPhases[w], kSpeeds[w], dir_vec};
+         field.AddWave(wave);
+      }
+      field.Finalize();
+
+      // Evaluate initial field
+      field.Compute(kT0);
+      CheckSolution(kCoords, field.Density(), field.Momentum(),
+                     field.Energy(), field.Time(), kNumWaves);
+
+      // March field
+      for (int n = 1; n <= kNumSteps; n++)
+      {
+         field.Advance(kDt);
+         REQUIRE(field.Time() == kT0 + n*kDt);
+         CheckSolution(kCoords, field.Density(), field.Momentum(),
+                        field.Energy(), field.Time(), kNumWaves);
+      }
+   }
+}
+
 #ifdef JABBER_WITH_APP
 
 TEST_CASE("1D flowfield computation via app library", "[1D][Compute][App]")
@@ -307,7 +1304,7 @@ TEST_CASE("1D flowfield computation via app library", "[1D][Compute][App]")
                                           random(kTimeExtents.first,
                                                    kTimeExtents.second))));
                                                    
-   const AcousticField::Kernel kernel = GENERATE(options<AcousticField::Kernel>());
+   const AcousticField::Kernel kernel = GENERATE(kernels());
 
    const int kNumWaves = GENERATE(1,2);
    CAPTURE(kNumWaves);
@@ -337,7 +1334,7 @@ TEST_CASE("1D flowfield computation via app library", "[1D][Compute][App]")
       }
 
       // Set kernel
-      config.Comp().kernel = GENERATE(options<AcousticField::Kernel>());
+      config.Comp().kernel = GENERATE(kernels());
       
       // Initialize AcousticField
       AcousticField field = InitializeAcousticField(config, kCoords, 1);
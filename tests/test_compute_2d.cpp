@@ -200,7 +200,6 @@ TEMPLATE_TEST_CASE_SIG("2D flowfield computation via kernel",
    {
       std::vector<double> rho_coeffs(kNumWaves);
       std::vector<double> rhoV_coeffs(2*kNumWaves);
-      std::vector<double> rhoE_coeffs(kNumWaves);
       std::vector<double> wave_omegas(kNumWaves);
       std::vector<double> k_dot_x_p_phi(kNumPts*kNumWaves);
 
@@ -213,7 +212,6 @@ TEMPLATE_TEST_CASE_SIG("2D flowfield computation via kernel",
          rho_coeffs[w] = kPAmps[w]/(kCBar*kCBar);
          rhoV_coeffs[w] = speed_encoder*k_hat[0]*kPAmps[w]/(kRhoBar*kCBar);
          rhoV_coeffs[kNumWaves+w] = speed_encoder*k_hat[1]*kPAmps[w]/(kRhoBar*kCBar);
-         rhoE_coeffs[w] = kPAmps[w]/(kGamma-1.0);
          wave_omegas[w] = 2*M_PI*kFreqs[w];
 
          const double U_bar_dot_k_hat = kUBar[0]*k_hat[0] + kUBar[1]*k_hat[1];
@@ -251,9 +249,9 @@ TEMPLATE_TEST_CASE_SIG("2D flowfield computation via kernel",
          // Compute
          ComputeKernel<2, TGridInnerLoop>(kNumPts, kRhoBar, kPBar, kUBar.data(),
                            kGamma, kNumWaves, time, rho_coeffs.data(), 
-                           rhoV_coeffs.data(), rhoE_coeffs.data(), 
-                           wave_omegas.data(), k_dot_x_p_phi.data(), 
-                           rho.data(), rhoU.data(), rhoE.data());
+                           rhoV_coeffs.data(), wave_omegas.data(), 
+                           k_dot_x_p_phi.data(), rho.data(), rhoU.data(), 
+                           rhoE.data());
 
          // Check solutions
          CheckSolution(kCoords, rho, rhoU, rhoE, time, kNumWaves);
@@ -274,7 +272,7 @@ TEST_CASE("2D flowfield computation via AcousticField",
                                                    kTimeExtents.second))));
 
    const AcousticField::Kernel kernel = 
-                        GENERATE(options<AcousticField::Kernel>());
+                        GENERATE(kernels());
    CAPTURE(kernel);
 
    const int kNumWaves = GENERATE(1,2);
@@ -318,7 +316,7 @@ TEST_CASE("2D flowfield computation via app library", "[2D][Compute][App]")
                                           random(kTimeExtents.first,
                                                    kTimeExtents.second))));
 
-   const AcousticField::Kernel kernel = GENERATE(options<AcousticField::Kernel>());
+   const AcousticField::Kernel kernel = GENERATE(kernels());
 
    const int kNumWaves = GENERATE(1,2);
    CAPTURE(kNumWaves);
@@ -348,7 +346,7 @@ TEST_CASE("2D flowfield computation via app library", "[2D][Compute][App]")
       }
 
       // Set kernel
-      config.Comp().kernel = GENERATE(options<AcousticField::Kernel>());
+      config.Comp().kernel = GENERATE(kernels());
 
       // Initialize AcousticField
       AcousticField field = InitializeAcousticField(config, kCoords, 2);
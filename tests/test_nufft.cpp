@@ -0,0 +1,183 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <jabber/jabber.hpp>
+
+#include <complex>
+#include <random>
+#include <vector>
+
+using namespace jabber;
+using namespace Catch::Generators;
+
+/// Seed for randomizer
+static constexpr int kSeed = 0;
+
+TEST_CASE("NUFFTPlan", "[NUFFT]")
+{
+   // Tighter tolerances in 3D require larger problems for the NUFFT to be
+   // cheaper than the direct sum, so are omitted
+   const auto [kDim, kTol] = GENERATE(table<int, double>({{1, 1e-4},
+                                                         {1, 1e-8},
+                                                         {1, 1e-12},
+                                                         {2, 1e-4},
+                                                         {2, 1e-8},
+                                                         {2, 1e-12},
+                                                         {3, 1e-4},
+                                                         {3, 1e-8}}));
+   constexpr int kNumChannels = 2;
+
+   // Sized such that the NUFFT is cheaper than the direct sum
+   const std::size_t kNumPts = 5000;
+   const int kNumWaves = (kDim == 3) ? 50000 : 5000;
+   const double kMaxK = (kDim == 3) ? 5.0 : 20.0;
+
+   std::mt19937 gen(kSeed);
+   std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+   std::vector<double> coords(kDim*kNumPts);
+   for (double &x : coords)
+   {
+      x = 3.0 + 2.0*dist(gen);
+   }
+   std::vector<double> wave_ks(kDim*kNumWaves);
+   for (double &k : wave_ks)
+   {
+      k = kMaxK*dist(gen);
+   }
+   std::vector<std::complex<double>> strengths(kNumChannels*kNumWaves);
+   for (std::complex<double> &c : strengths)
+   {
+      c = {dist(gen), dist(gen)};
+   }
+
+   NUFFTPlan plan(kDim, kNumPts, coords.data(), kNumWaves, wave_ks.data(),
+                  kNumChannels, kTol);
+   REQUIRE(plan.UsesFFT());
+
+   std::vector<double> out(kNumChannels*kNumPts);
+   double *out_ptrs[kNumChannels] = {out.data(), out.data() + kNumPts};
+   plan.Execute(coords.data(), wave_ks.data(), strengths.data(), out_ptrs);
+
+   // Compare to direct sum at a subset of points
+   for (int q = 0; q < kNumChannels; q++)
+   {
+      double sum_abs = 0.0;
+      for (int j = 0; j < kNumWaves; j++)
+      {
+         sum_abs += std::abs(strengths[q*kNumWaves + j]);
+      }
+      for (std::size_t i = 0; i < kNumPts; i += 50)
+      {
+         double exact = 0.0;
+         for (int j = 0; j < kNumWaves; j++)
+         {
+            double phase = 0.0;
+            for (int d = 0; d < kDim; d++)
+            {
+               phase += wave_ks[d*kNumWaves + j]*coords[d*kNumPts + i];
+            }
+            const std::complex<double> &c = strengths[q*kNumWaves + j];
+            exact += c.real()*std::cos(phase) - c.imag()*std::sin(phase);
+         }
+         CHECK(std::abs(out[q*kNumPts + i] - exact) <= kTol*sum_abs);
+      }
+   }
+}
+
+TEST_CASE("NUFFTPlan direct fallback", "[NUFFT]")
+{
+   const int kDim = GENERATE(1, 2, 3);
+   constexpr std::size_t kNumPts = 5;
+   constexpr int kNumWaves = 3;
+
+   std::mt19937 gen(kSeed);
+   std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+   std::vector<double> coords(kDim*kNumPts), wave_ks(kDim*kNumWaves);
+   for (double &x : coords)
+   {
+      x = dist(gen);
+   }
+   for (double &k : wave_ks)
+   {
+      k = 10.0*dist(gen);
+   }
+   std::vector<std::complex<double>> strengths(kNumWaves);
+   for (std::complex<double> &c : strengths)
+   {
+      c = {dist(gen), dist(gen)};
+   }
+
+   NUFFTPlan plan(kDim, kNumPts, coords.data(), kNumWaves, wave_ks.data(),
+                  1, 1e-10);
+   REQUIRE_FALSE(plan.UsesFFT());
+
+   std::vector<double> out(kNumPts);
+   double *out_ptr = out.data();
+   plan.Execute(coords.data(), wave_ks.data(), strengths.data(), &out_ptr);
+
+   for (std::size_t i = 0; i < kNumPts; i++)
+   {
+      double exact = 0.0;
+      for (int j = 0; j < kNumWaves; j++)
+      {
+         double phase = 0.0;
+         for (int d = 0; d < kDim; d++)
+         {
+            phase += wave_ks[d*kNumWaves + j]*coords[d*kNumPts + i];
+         }
+         exact += strengths[j].real()*std::cos(phase) -
+                  strengths[j].imag()*std::sin(phase);
+      }
+      CHECK(std::abs(out[i] - exact) <= 1e-14*(1.0 + std::abs(exact)));
+   }
+}
+
+TEST_CASE("ProgressionFFTPlan", "[NUFFT]")
+{
+   const double kTol = GENERATE(1e-4, 1e-8, 1e-12);
+   const double kDeltaK = GENERATE(0.7, -0.7);
+   CAPTURE(kTol, kDeltaK);
+
+   // Sized such that synthesis is cheaper than the direct sum
+   constexpr std::size_t kNumPts = 5000;
+   constexpr int kNumWaves = 1000;
+   constexpr double kFirstK = 3.0;
+
+   std::mt19937 gen(kSeed);
+   std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+   std::vector<double> projs(kNumPts);
+   for (double &s : projs)
+   {
+      s = 3.0 + 2.0*dist(gen);
+   }
+   std::vector<std::complex<double>> strengths(kNumWaves);
+   double sum_abs = 0.0;
+   for (std::complex<double> &c : strengths)
+   {
+      c = {dist(gen), dist(gen)};
+      sum_abs += std::abs(c);
+   }
+
+   ProgressionFFTPlan plan(kNumPts, projs.data(), kNumWaves, kFirstK, 
+                           kDeltaK, kTol);
+   REQUIRE(plan.UsesFFT());
+
+   std::vector<double> out(kNumPts);
+   plan.Execute(strengths.data(), out.data());
+
+   // Compare to direct sum at a subset of points
+   for (std::size_t i = 0; i < kNumPts; i += 50)
+   {
+      double exact = 0.0;
+      for (int j = 0; j < kNumWaves; j++)
+      {
+         const double phase = (kFirstK + j*kDeltaK)*projs[i];
+         exact += strengths[j].real()*std::cos(phase) -
+                  strengths[j].imag()*std::sin(phase);
+      }
+      CHECK(std::abs(out[i] - exact) <= kTol*sum_abs);
+   }
+}
@@ -1,7 +1,18 @@
 #ifndef JABBER_TEST_UTILS
 #define JABBER_TEST_UTILS
 
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include <catch2/generators/catch_generators_all.hpp>
+
+#include <jabber/jabber.hpp>
+
+#include <cmath>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace jabber_test
 {
 
@@ -51,6 +62,20 @@ Catch::Generators::GeneratorWrapper<T> options()
                Catch::Detail::make_unique<OptionGenerator<T>>());
 }
 
+/**
+ * @brief Generator-wrapper creator for list over all kernels that an 
+ * jabber::AcousticField may be constructed with, i.e. other than 
+ * jabber::AcousticField::Kernel::Custom. Use by \c GENERATE(kernels()).
+ */
+inline Catch::Generators::GeneratorWrapper<jabber::AcousticField::Kernel> 
+kernels()
+{
+   using Kernel = jabber::AcousticField::Kernel;
+   return Catch::Generators::filter([](const Kernel kernel)
+                                    { return kernel != Kernel::Custom; },
+                                    options<Kernel>());
+}
+
 /// Random generator for a \ref OptionEnum enumerator.
 template<OptionEnum T>
 class RandomOptionGenerator : public Catch::Generators::IGenerator<T>
@@ -90,6 +115,147 @@ Catch::Generators::GeneratorWrapper<T> random_option()
             Catch::Detail::make_unique<RandomOptionGenerator<T>>());
 }
 
+/**
+ * @brief Check the conservative variables of \p field at its points 
+ * \p coords (XYZ XYZ ordering) against the direct sum of its waves at 
+ * \ref jabber::AcousticField::Time(), given the pressure perturbation is 
+ * within \p tol of the sum of absolute wave amplitudes.
+ * 
+ * @details The tolerance of each variable is that of the pressure 
+ * perturbation linearized about the base flow, doubled to cover the 
+ * higher-order terms.
+ */
+inline void CheckDirectSum(const jabber::AcousticField &field, 
+                           std::span<const double> coords, double tol)
+{
+   using namespace Catch::Matchers;
+
+   const int dim = field.Dim();
+   const double t = field.Time();
+   const double rho_bar = field.BaseDensity();
+   const double p_bar = field.BasePressure();
+   const double gamma = field.Gamma();
+   const std::vector<double> &U_bar = field.BaseVelocity();
+   const double c_bar = std::sqrt(gamma*p_bar/rho_bar);
+
+   double mag_U = 0.0;
+   for (const double &U_d : U_bar)
+   {
+      mag_U += U_d*U_d;
+   }
+   mag_U = std::sqrt(mag_U);
+   double sum_amps = 0.0;
+   for (const jabber::Wave &wave : field.Waves())
+   {
+      sum_amps += std::abs(wave.amplitude);
+   }
+
+   const double p_tol = tol*sum_amps;
+   const double rho_tol = p_tol/(c_bar*c_bar);
+   const double u_tol = p_tol/(rho_bar*c_bar);
+   const double rhoV_tol = 2*(rho_bar*u_tol + mag_U*rho_tol);
+   const double rhoE_tol = 2*(p_tol/(gamma - 1.0) + rho_bar*mag_U*u_tol + 
+                              0.5*mag_U*mag_U*rho_tol);
+
+   for (std::size_t i = 0; i < field.NumPoints(); i++)
+   {
+      const double *x = coords.data() + i*dim;
+      double p_prime = 0.0;
+      std::vector<double> u = U_bar;
+      for (const jabber::Wave &wave : field.Waves())
+      {
+         const double sign = (wave.speed == 'S') ? -1.0 : 1.0;
+         const double omega = 2*M_PI*wave.frequency;
+         double denom = sign*c_bar;
+         double k_hat_x = 0.0;
+         for (int d = 0; d < dim; d++)
+         {
+            denom += U_bar[d]*wave.k_hat[d];
+            k_hat_x += wave.k_hat[d]*x[d];
+         }
+         const double p_wave = wave.amplitude*std::cos((omega/denom)*k_hat_x
+                                                   + wave.phase - omega*t);
+         p_prime += p_wave;
+         for (int d = 0; d < dim; d++)
+         {
+            u[d] += sign*wave.k_hat[d]*p_wave/(rho_bar*c_bar);
+         }
+      }
+
+      const double rho = rho_bar + p_prime/(c_bar*c_bar);
+      double mag_u_sq = 0.0;
+      CAPTURE(i, t);
+      CHECK_THAT(field.Density()[i], WithinAbs(rho, 2*rho_tol));
+      for (int d = 0; d < dim; d++)
+      {
+         mag_u_sq += u[d]*u[d];
+         CHECK_THAT(field.Momentum(d)[i], WithinAbs(rho*u[d], rhoV_tol));
+      }
+      CHECK_THAT(field.Energy()[i], 
+                  WithinAbs((p_bar + p_prime)/(gamma - 1.0) + 
+                              0.5*rho*mag_u_sq, rhoE_tol));
+   }
+}
+
+/**
+ * @brief Check \p field at its points \p coords after 
+ * jabber::AcousticField::Compute() at each of \p times, as in 
+ * \ref CheckDirectSum().
+ */
+inline void CheckDirectSums(jabber::AcousticField &field, 
+                              std::span<const double> coords,
+                              std::span<const double> times, double tol)
+{
+   for (const double &t : times)
+   {
+      field.Compute(t);
+      CheckDirectSum(field, coords, tol);
+   }
+}
+
+/**
+ * @brief Get \p num_waves random fast waves of \p dim dimensions along the
+ * first axis, with amplitudes in [1,10], frequencies within 
+ * \p freq_extents, and phases in [0,2π].
+ */
+inline std::vector<jabber::Wave> RandomWaves(int dim, int num_waves,
+                                 std::pair<double,double> freq_extents)
+{
+   using namespace Catch::Generators;
+
+   const std::vector<double> amps = chunk(num_waves, random(1.0, 10.0)).get();
+   const std::vector<double> freqs = chunk(num_waves, 
+                                          random(freq_extents.first,
+                                                   freq_extents.second)).get();
+   const std::vector<double> phases = 
+                              chunk(num_waves, random(0.0, 2*M_PI)).get();
+
+   std::vector<double> k_hat(dim, 0.0);
+   k_hat[0] = 1.0;
+   std::vector<jabber::Wave> waves;
+   for (int w = 0; w < num_waves; w++)
+   {
+      waves.push_back({amps[w], freqs[w], phases[w], 'F', k_hat});
+   }
+   return waves;
+}
+
+/// Registration of an engine in EngineRegistry for the lifetime of this.
+class ScopedRegistration
+{
+private:
+   const std::string name_;
+public:
+   ScopedRegistration(std::string name, jabber::EngineRegistry::Factory factory,
+                        jabber::EngineCapabilities caps)
+   : name_(std::move(name))
+   {
+      jabber::EngineRegistry::Register(name_, std::move(factory), caps);
+   }
+
+   ~ScopedRegistration() { jabber::EngineRegistry::Unregister(name_); }
+};
+
 } // namespace jabber_test
 
 #endif // JABBER_TEST_UTILS